@@ -3,6 +3,9 @@
  * uint16_t modn16(const uint64_t *n, unsigned int count, uint16_t modn) ;
  *      -- big-endian (n, count) % modn, 16-bit modn
  *
+ * uint32_t modn32(const uint64_t *n, unsigned int count, uint32_t modn) ;
+ *      -- big-endian (n, count) % modn, modn below 2^31
+ *
  * if __SIZEOF_INT128__ is defined, AND uint128_t has been defined/typedef'd:
  * uint64_t modn64(const uint64_t *n, unsigned int count, uint64_t modn) ;
  *      -- big-endian (n, count) % modn, 64-bit modn
@@ -91,6 +94,36 @@ static inline uint16_t modn16(const uint64_t *n, unsigned int count,
 }
 
 
+/*--------------------------------------
+ * return (n, count) % (32-bit) modn; modn MUST be below 2^31
+ *
+ * same digit fold as modn16(); acc and the 2^64 residue both stay
+ * under modn, so the widening product fits u64 up to 2^31 moduli
+ */
+static inline uint32_t modn32(const uint64_t *n, unsigned int count,
+                                    uint32_t modn)
+{
+	uint64_t acc = 0;
+
+	if ((modn >= 2) && (modn < ((uint32_t) 1 << 31)) && n && count) {
+		uint32_t mod264 = (uint32_t)
+		                  (((uint64_t) -((int64_t) modn)) % modn);
+							// floor(2^64 % modn)
+		unsigned int i;
+
+		for (i=0; i<count; ++i) {
+			uint32_t red = (uint32_t) (n[i] % modn);
+
+			acc *= mod264;
+			acc += red;
+			acc %= modn;
+		}
+	}
+
+	return (uint32_t) acc;
+}
+
+
 /*--------------------------------------
  * check parameters which are expected to fit an u64
  *
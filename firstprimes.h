@@ -1135,6 +1135,504 @@ uint16_t firstprimes_mod2range_simd[3456] = {
 	0x835d,0x832b,0x8325,0x831b,0x8313,0x8309,0x82fd,0x82f7,0x82e5,0x82e3,0x82cd,0x82c7,0x82c5,0x82c1,0x82bb,0x82b3,
 	0x82ad,0x82a7,0x829d,0x828b,0x8289,0x8273,0x8271,0x8261,0x8253,0x8249,0x8243,0x8241,0x8235,0x822b,0x8217,0x8213
 } ;
+
+
+// floor(2^32 / prime): Barrett-style quotient-estimate magic for the
+// batch state-initialization path (reduce 16-bit chunks against 16
+// primes per group without per-prime division); the estimate is off
+// by at most one, see simd_modfold16x16()
+
+static const
+__attribute__((aligned(64)))
+//
+uint32_t firstprimes_magic32_simd[3456] = {
+	0x33333333,0x24924924,0x1745d174,0x13b13b13,0x0f0f0f0f,0x0d79435e,0x0b21642c,0x08d3dcb0,
+	0x08421084,0x06eb3e45,0x063e7063,0x05f417d0,0x0572620a,0x04d4873e,0x0456c797,0x04325c53,
+	0x03d22635,0x039b0ad1,0x0381c0e0,0x033d91d2,0x03159721,0x02e05c0b,0x02a3a0fd,0x0288df0c,
+	0x027c4597,0x02647c69,0x02593f69,0x0243f6f0,0x02040810,0x01f44659,0x01de5d6e,0x01d77b65,
+	0x01b7d6c3,0x01b20364,0x01a16d3f,0x01920fb4,0x01886e5f,0x017ad220,0x016e1f76,0x016a13cd,
+	0x01571ed3,0x01539094,0x014cab88,0x0149539e,0x013698df,0x0125e227,0x0120b470,0x011e2ef3,
+	0x01194538,0x0112358e,0x010fef01,0x0105197f,0x00ff00ff,0x00f92fb2,0x00f3a0d5,0x00f1d48b,
+	0x00ec9791,0x00e93965,0x00e79372,0x00dfac1f,0x00d578e9,0x00d2ba08,0x00d16154,0x00cebcf8,
+	0x00c5fe74,0x00c27806,0x00bcdd53,0x00bbc840,0x00b9a786,0x00b68d31,0x00b2927c,0x00afb321,
+	0x00aceb0f,0x00ab1cbd,0x00a87917,0x00a513fd,0x00a36e71,0x00a03c16,0x009c6916,0x009baade,
+	0x00980e41,0x00975a75,0x009548e4,0x0093efd1,0x0091f5bc,0x008f67a1,0x008e2917,0x008d8be3,
+	0x008c5584,0x0088d180,0x00869222,0x0085797b,0x008355ac,0x00824a4e,0x0080c121,0x007dc9f3,
+	0x007d4ece,0x0079237d,0x0077cf53,0x0075a8ac,0x007467ac,0x00732d70,0x0072c62a,0x007194a1,
+	0x006fa549,0x006e8419,0x006d68b5,0x006d0b80,0x006bf790,0x006ae907,0x006a3799,0x0069dfbd,
+	0x0067dc4c,0x00663d80,0x0065ec17,0x00654ac8,0x00645c85,0x00637299,0x00632591,0x006160ff,
+	0x0060cdb5,0x005ff401,0x005ed79e,0x005d7d42,0x005c6f35,0x005b2618,0x005a2553,0x0059686c,
+	0x0058ae97,0x0058345f,0x005743d5,0x005692c4,0x00561e46,0x005538ed,0x0054c807,0x005345ef,
+	0x00523a75,0x00510237,0x0050cf12,0x004fd319,0x004fa170,0x004f3ed6,0x004f0de5,0x004e1cae,
+	0x004cd47b,0x004c78ae,0x004c4b19,0x004bf093,0x004aba3c,0x004a6360,0x004a383e,0x0049e28f,
+	0x0048417b,0x0047f043,0x00474ff2,0x00468b6f,0x0045f13f,0x0045a522,0x0045342c,0x0044c4a2,
+	0x0043c5c2,0x00437e49,0x0043142d,0x0042ab5c,0x00422195,0x0041bbb2,0x0040f391,0x0040b1e9,
+	0x00405064,0x00403024,0x003f90c2,0x003f7141,0x003f1377,0x003e7988,0x003e5b19,0x003dc4a5,
+	0x003da6e4,0x003d4e4f,0x003c4a6b,0x003c11d5,0x003bf5b1,0x003bbdb9,0x003b6a88,0x003b183c,
+	0x003aabe3,0x003a5ba3,0x003a0c3e,0x0038f035,0x0038d6ec,0x003859cf,0x0037f741,0x00377df0,
+	0x00373622,0x0036ef0c,0x0036915f,0x0036072c,0x0035d9b7,0x00359615,0x0035531c,0x00353cee,
+	0x0034fad3,0x00347884,0x00340dd3,0x003351fd,0x00333d72,0x0033148d,0x0032d7ae,0x0032c385,
+	0x00328766,0x00325fa1,0x00324bd6,0x0032246e,0x0031afa5,0x00319c63,0x003162f7,0x0030271f,
+	0x002ff104,0x002fbb62,0x002f7499,0x002ed84a,0x002e832d,0x002e0e08,0x002decfb,0x002ddc87,
+	0x002dbbc1,0x002d8af0,0x002d4a7b,0x002d2a85,0x002d1a9a,0x002ceb1e,0x002c8d50,0x002c404d,
+	0x002c3106,0x002c1297,0x002c0370,0x002be540,0x002bb845,0x002b5f62,0x002b07e6,0x002ace56,
+	0x002a791d,0x002a4eff,0x002a3319,0x002a0986,0x0029d295,0x0029b752,0x00298137,0x0029665e,
+	0x00290975,0x0028ef35,0x0028c815,0x0028bb1b,0x0028a13f,0x00287ab3,0x00286dea,0x002847bf,
+	0x002808c1,0x00278d0e,0x00276886,0x00275051,0x00274441,0x0026b5c1,0x00269e65,0x002692c2,
+	0x002658fa,0x00261487,0x00260936,0x0025d106,0x0025a48a,0x00258371,0x00256292,0x002541ed,
+	0x0024e150,0x0024c18b,0x0024ac7b,0x0024a1fc,0x00246380,0x0024300f,0x0023f314,0x0023cade,
+	0x00237b7e,0x00233729,0x00231a30,0x002306fa,0x0022fd67,0x0022ea50,0x0022e0cc,0x0022b188,
+	0x00227977,0x00225db3,0x0022421b,0x0021f05b,0x0021e75d,0x0021a01d,0x0021974a,0x00213767,
+	0x00211d9f,0x0020fb7d,0x0020e212,0x0020d135,0x0020c8cd,0x0020b80b,0x002096b9,0x00207de7,
+	0x002054de,0x00204cb6,0x00202428,0x001fec0c,0x001fc46f,0x001facda,0x001f7e17,0x001f765a,
+	0x001f66ea,0x001f5f38,0x001f38f4,0x001f0b85,0x001f03ff,0x001ec853,0x001ec0ee,0x001eaad3,
+	0x001e9c28,0x001e94d8,0x001e707b,0x001e53a2,0x001e1380,0x001dbf9f,0x001db1d1,0x001d9d35,
+	0x001d81e6,0x001d4bdf,0x001d452c,0x001d37cf,0x001d1d3a,0x001ce89f,0x001ce219,0x001cd516,
+	0x001cbb33,0x001ca7e7,0x001c94b5,0x001c87f7,0x001c6202,0x001c5bb8,0x001c1743,0x001c04d0,
+	0x001bfeb0,0x001bec5d,0x001be034,0x001bce09,0x001ba402,0x001b9225,0x001b864a,0x001b8060,
+	0x001b6eb1,0x001b62f4,0x001b516b,0x001b2e9c,0x001b1d56,0x001b0c26,0x001ae45f,0x001ad917,
+	0x001ac83d,0x001aa6c7,0x001a90a7,0x001a8027,0x001a7533,0x001a2ed7,0x0019fefc,0x0019e4b0,
+	0x0019cfcd,0x0019c569,0x0019b5e1,0x0019b0b8,0x0019a149,0x00196951,0x00194b30,0x00194631,
+	0x00191e84,0x00190adb,0x00190113,0x0018e3e6,0x0018c233,0x0018aa58,0x0018a598,0x00189c1e,
+	0x0018893f,0x00187b2b,0x00186d27,0x001863d8,0x00185f33,0x001855ef,0x00184816,0x001835b7,
+	0x00182c92,0x00182802,0x00181a5c,0x001803c0,0x0017ff40,0x0017e8d6,0x0017d706,0x0017ce28,
+	0x0017af52,0x0017997d,0x00177f7e,0x00177b2f,0x00176e4a,0x001765b9,0x00176173,0x00173f7a,
+	0x00172211,0x001719b7,0x00170d3c,0x0016fcad,0x0016f051,0x0016e81b,0x0016c372,0x0016b34c,
+	0x00169f3c,0x00169344,0x00168759,0x00167787,0x001663e1,0x00164c7a,0x0016316a,0x001629ba,
+	0x00161e3d,0x001612cc,0x00160efe,0x0015da45,0x0015d68a,0x0015c3f9,0x0015b535,0x0015addb,
+	0x00159445,0x00158d01,0x00157e87,0x001568f5,0x00155e3c,0x001548ea,0x001541d8,0x00153747,
+	0x00151456,0x00150309,0x0014ff97,0x0014e42c,0x0014b835,0x0014b182,0x0014ae2a,0x00149a32,
+	0x00149044,0x001489aa,0x001475f8,0x00146c2c,0x00145f2c,0x001458b2,0x00144bcb,0x001428a1,
+	0x00142575,0x00141f20,0x00141bf6,0x00140914,0x0013dd8b,0x0013da76,0x0013d13e,0x0013c80e,
+	0x0013bee6,0x0013b8d0,0x0013afb7,0x0013acb0,0x00139a9c,0x0013949c,0x001382b4,0x00137fbb,
+	0x001370ec,0x00136df9,0x0013567d,0x00135392,0x00133c56,0x001333ae,0x0013170a,0x0013005f,
+	0x0012f51d,0x0012ef81,0x0012ecb4,0x0012e71d,0x0012e453,0x0012c5d9,0x0012badc,0x0012aa78,
+	0x0012a251,0x001294cb,0x00129219,0x00128cb7,0x001284aa,0x001281fc,0x001279f9,0x00126cad,
+	0x00126a06,0x00125a2f,0x00124d10,0x00124a73,0x00123d6a,0x00122b4b,0x00122391,0x00121e6f,
+	0x001216c0,0x00120c8c,0x001204ed,0x0011fd54,0x0011e931,0x0011da34,0x0011d7b6,0x0011d2be,
+	0x0011c170,0x0011ba0f,0x0011b528,0x0011ab61,0x00119f37,0x00119588,0x00118e4c,0x00118716,
+	0x00116cd6,0x001165bb,0x0011635e,0x00115797,0x00114734,0x0011428b,0x00113b92,0x001126ca,
+	0x0011247e,0x0011190b,0x0011091d,0x00110496,0x00110253,0x0010f70d,0x0010e75e,0x0010e2e9,
+	0x0010da04,0x0010c624,0x0010c1c0,0x0010bb2e,0x0010b8fe,0x0010b4a1,0x0010ae19,0x0010abec,
+	0x00109eef,0x00109a9f,0x00108531,0x00106dde,0x00106141,0x00105f29,0x00105afa,0x001054b7,
+	0x00104e79,0x00104c66,0x0010462e,0x00102f8b,0x00102d7f,0x0010275f,0x00101721,0x00101112,
+	0x00100501,0x00100300,0x000ffd00,0x000ff10e,0x000fe13b,0x000fdf43,0x000fdb54,0x000fd572,
+	0x000fc7c8,0x000fc3e5,0x000fc1f4,0x000fb092,0x000f999f,0x000f9023,0x000f8a78,0x000f8895,
+	0x000f7f2e,0x000f7d4e,0x000f73f5,0x000f7217,0x000f68cb,0x000f633d,0x000f6163,0x000f582b,
+	0x000f5654,0x000f4d2a,0x000f47af,0x000f4066,0x000f2555,0x000f1c64,0x000f1a9b,0x000f11b7,
+	0x000f0aa2,0x000f0556,0x000efc8b,0x000eecd1,0x000ee79a,0x000edd38,0x000ed2e4,0x000ed12c,
+	0x000ec1cd,0x000ebcb4,0x000eb950,0x000eb43d,0x000eaf2d,0x000ea014,0x000e9e68,0x000e9614,
+	0x000e8a7a,0x000e8587,0x000e823d,0x000e8098,0x000e7d4f,0x000e69bb,0x000e681c,0x000e5e68,
+	0x000e5993,0x000e4cbf,0x000e465e,0x000e4199,0x000e3cd8,0x000e2ea5,0x000e221e,0x000e208f,
+	0x000e1d71,0x000e18c7,0x000e173a,0x000e1294,0x000e0df1,0x000e063e,0x000e01a4,0x000df878,
+	0x000def57,0x000de1bd,0x000de03c,0x000ddbba,0x000dd8bb,0x000dcb4d,0x000dc55d,0x000db3ad,
+	0x000db0be,0x000daf48,0x000dac5b,0x000da7fb,0x000da686,0x000d9dd0,0x000d9aeb,0x000d90d3,
+	0x000d7b64,0x000d744e,0x000d7011,0x000d67a0,0x000d5dd3,0x000d59a4,0x000d52b2,0x000d4a65,
+	0x000d4904,0x000d4642,0x000d4222,0x000d3ca6,0x000d388c,0x000d31bc,0x000d3060,0x000d2da9,
+	0x000d2430,0x000d2025,0x000d1c1d,0x000d196e,0x000d156a,0x000d1413,0x000d0d68,0x000d0c14,
+	0x000d0179,0x000cf990,0x000cf44f,0x000ce88d,0x000ce5f3,0x000ce20e,0x000cda4b,0x000cd901,
+	0x000cd524,0x000cd149,0x000ccd70,0x000cbb9c,0x000cb7d0,0x000caefe,0x000cac7b,0x000ca778,
+	0x000ca13a,0x000c9c40,0x000c94d0,0x000c89b8,0x000c8744,0x000c860a,0x000c8397,0x000c74fa,
+	0x000c6db8,0x000c6a1a,0x000c68e6,0x000c5f4e,0x000c5bb8,0x000c5825,0x000c4fd5,0x000c49ec,
+	0x000c41b0,0x000c3f57,0x000c2ddc,0x000c2a63,0x000c26ec,0x000c2377,0x000c1ede,0x000c1b6e,
+	0x000c1924,0x000c17ff,0x000c1128,0x000c0dbf,0x000c0b7a,0x000c0a58,0x000c06f4,0x000bfa92,
+	0x000bf736,0x000bf618,0x000bf3dc,0x000be9d9,0x000be8bd,0x000be686,0x000bdfe6,0x000bdecc,
+	0x000bdb80,0x000bd94e,0x000bcb1d,0x000bc7db,0x000bc49b,0x000bc272,0x000bbe21,0x000bb8c1,
+	0x000ba7ad,0x000b9f36,0x000b9e28,0x000b9aff,0x000b98e4,0x000b97d7,0x000b95be,0x000b94b2,
+	0x000b8f77,0x000b882d,0x000b850f,0x000b82fd,0x000b7eda,0x000b79b3,0x000b769e,0x000b6c63,
+	0x000b6a59,0x000b6955,0x000b6648,0x000b5722,0x000b5520,0x000b511e,0x000b4c1f,0x000b4922,
+	0x000b4627,0x000b4230,0x000b3f38,0x000b394d,0x000b3756,0x000b3463,0x000b3368,0x000b3078,
+	0x000b2e84,0x000b2b97,0x000b2a9d,0x000b25c0,0x000b24c8,0x000b1d0a,0x000b1a26,0x000b108d,
+	0x000b0ea4,0x000b08ec,0x000b0247,0x000af515,0x000af246,0x000ae8f1,0x000ae715,0x000adec0,
+	0x000adb10,0x000ad84e,0x000ad678,0x000ad3b8,0x000acd52,0x000aca97,0x000ac7dd,0x000ac354,
+	0x000ac26d,0x000abde9,0x000ab883,0x000ab4ed,0x000ab074,0x000aaf90,0x000aab1c,0x000aa78f,
+	0x000aa23f,0x000a9dd6,0x000a9350,0x000a9270,0x000a90b1,0x000a8d35,0x000a8a9a,0x000a88de,
+	0x000a8567,0x000a7da4,0x000a7959,0x000a76c8,0x000a7438,0x000a735d,0x000a70ce,0x000a6c8e,
+	0x000a6779,0x000a66a0,0x000a6268,0x000a5fe2,0x000a5d5c,0x000a5ad9,0x000a5780,0x000a54ff,
+	0x000a50d5,0x000a4e57,0x000a4d83,0x000a4b06,0x000a488b,0x000a4611,0x000a41f4,0x000a3eab,
+	0x000a34dd,0x000a326d,0x000a2985,0x000a28b7,0x000a217a,0x000a1fe0,0x000a1cad,0x000a18b0,
+	0x000a0ccc,0x000a09a5,0x000a0294,0x000a0104,0x000a003c,0x0009fc55,0x0009f9ff,0x0009f938,
+	0x0009f6e4,0x0009f557,0x0009ee63,0x0009eb4f,0x0009e6b4,0x0009dfd4,0x0009d9c0,0x0009d77a,
+	0x0009d6b9,0x0009d231,0x0009cfef,0x0009cc2e,0x0009cb6e,0x0009c7b0,0x0009c6f0,0x0009c4b3,
+	0x0009c0fb,0x0009bbca,0x0009ba4f,0x0009b178,0x0009b0bc,0x0009aae1,0x0009aa26,0x0009a681,
+	0x0009a5c7,0x0009a226,0x00099aeb,0x0009997a,0x000998c2,0x00099752,0x00099473,0x00098eba,
+	0x00098c96,0x00098a74,0x000989be,0x0009857c,0x00097fd5,0x00097d04,0x00097b9c,0x00097981,
+	0x00096f07,0x00096e55,0x00096add,0x00096a2c,0x00096818,0x000966b7,0x000964a5,0x00096294,
+	0x00095fd4,0x00095dc5,0x00095c67,0x0009584d,0x00095641,0x00095389,0x00094f77,0x00094e1c,
+	0x00094962,0x00094559,0x000941ff,0x000939fd,0x000937ff,0x00093405,0x00093209,0x00093160,
+	0x00092a22,0x00092783,0x000921a2,0x00091e62,0x00091c6f,0x000917e7,0x0009169d,0x000915f8,
+	0x00091409,0x000910d2,0x00090e41,0x00090c55,0x00090b0e,0x00090924,0x0008ff9d,0x0008fb31,
+	0x0008f80c,0x0008f76b,0x0008f3a8,0x0008f087,0x0008efe7,0x0008eaec,0x0008ea4d,0x0008e4ba,
+	0x0008dd56,0x0008d7d3,0x0008d5fe,0x0008d120,0x0008cbac,0x0008c9dc,0x0008c942,0x0008c3d7,
+	0x0008c2a4,0x0008c0d8,0x0008c03f,0x0008bd42,0x0008bae0,0x0008b7e7,0x0008b61f,0x0008b458,
+	0x0008b1fb,0x0008b0cc,0x0008af07,0x0008ae71,0x0008ab80,0x0008aaea,0x0008a766,0x0008a63a,
+	0x0008a47a,0x0008a2ba,0x0008a225,0x00089ea8,0x00089d7f,0x00089972,0x00089442,0x0008931b,
+	0x00089163,0x00088baa,0x00088a86,0x0008883f,0x0008868b,0x00088568,0x00088324,0x00088202,
+	0x00087e0f,0x00087c5e,0x00087b3e,0x00087751,0x000873f6,0x000872d9,0x0008724a,0x000869f6,
+	0x000868db,0x0008623f,0x00086099,0x00085ef5,0x00085bad,0x00085868,0x0008549b,0x000852fb,
+	0x000851e6,0x0008515b,0x00085047,0x00084b6d,0x000849d1,0x0008469a,0x00084476,0x000842dd,
+	0x000841cc,0x00083e9b,0x00083e13,0x00083ae5,0x000832fd,0x00082ecb,0x00082e45,0x00082cb4,
+	0x000826fa,0x00082359,0x000821cc,0x00081f37,0x00081c21,0x00081a97,0x00081a13,0x0008190d,
+	0x00081701,0x00081473,0x000812ec,0x00081165,0x00080b4f,0x000807c7,0x00080644,0x00080543,
+	0x00080341,0x00080040,0x0007fbc2,0x0007f945,0x0007f8c6,0x0007f64b,0x0007f5cd,0x0007f4cf,
+	0x0007f354,0x0007ee67,0x0007eced,0x0007ebf2,0x0007e885,0x0007e78b,0x0007e70e,0x0007e615,
+	0x0007e2ad,0x0007e138,0x0007de50,0x0007d886,0x0007d61f,0x0007d4af,0x0007d2c5,0x0007d062,
+	0x0007cfe8,0x0007c8c7,0x0007c7d5,0x0007c66a,0x0007c5f1,0x0007c31d,0x0007c22c,0x0007bee3,
+	0x0007bd7b,0x0007b58e,0x0007b2c6,0x0007b0ec,0x0007af8a,0x0007ad3c,0x0007acc6,0x0007abda,
+	0x0007a744,0x0007a4fb,0x0007a328,0x00079f85,0x00079f10,0x00079ccc,0x000799a2,0x000798bb,
+	0x00079848,0x00079595,0x0007943c,0x000790a6,0x00078f4f,0x00078d86,0x00078ca2,0x00078adb,
+	0x000789f7,0x000788a3,0x000786dd,0x00078589,0x00078436,0x00078191,0x0007803f,0x00077f5e,
+	0x00077e0d,0x00077cbd,0x00077afd,0x0007770f,0x00077631,0x000771da,0x000770fc,0x00076e64,
+	0x00076df6,0x00076bcf,0x00076a84,0x00076a16,0x000767f1,0x00076560,0x000764f3,0x00076418,
+	0x00075fd6,0x00075e90,0x00075838,0x000756f5,0x0007561d,0x0007546f,0x00075257,0x00074fd4,
+	0x00074e94,0x00074e29,0x00074857,0x000747ed,0x000746af,0x000745dc,0x00074572,0x00074225,
+	0x00073fae,0x00073f45,0x00073e0a,0x00073bfe,0x00073a5c,0x00073579,0x0007330a,0x000731d4,
+	0x00072e32,0x00072cfd,0x00072c2f,0x00072960,0x0007282c,0x0007275f,0x000724fa,0x00072362,
+	0x00072230,0x00071fcf,0x00071f04,0x00071dd4,0x00071b75,0x00071a46,0x000717e9,0x00071785,
+	0x00071461,0x00071079,0x00070fb1,0x00070f4e,0x00070d5c,0x000709de,0x00070852,0x0007078d,
+	0x000704da,0x00070415,0x000703b2,0x0007028b,0x0006fe55,0x0006fd30,0x0006fa85,0x0006f961,
+	0x0006f83d,0x0006f658,0x0006f535,0x0006f4d4,0x0006f2f1,0x0006f290,0x0006f1cf,0x0006f16f,
+	0x0006ed4d,0x0006eced,0x0006ec2d,0x0006eb0e,0x0006e9ef,0x0006e7b2,0x0006e694,0x0006e3fa,
+	0x0006e220,0x0006dfe8,0x0006decd,0x0006dd54,0x0006dc97,0x0006d5ff,0x0006d371,0x0006d143,
+	0x0006d02c,0x0006cf73,0x0006ce5c,0x0006ce00,0x0006cbd5,0x0006cac0,0x0006c897,0x0006c5b8,
+	0x0006c55c,0x0006c392,0x0006c225,0x0006be3a,0x0006bddf,0x0006bbbe,0x0006baaf,0x0006b9f9,
+	0x0006b8ea,0x0006b5be,0x0006b564,0x0006b349,0x0006b23c,0x0006b188,0x0006af6f,0x0006ae0a,
+	0x0006acff,0x0006aae8,0x0006aa37,0x0006a92c,0x0006a719,0x0006a60f,0x0006a5b7,0x0006a3a5,
+	0x0006a195,0x0006a0e5,0x00069e7f,0x00069d78,0x00069abd,0x000699b7,0x00069960,0x000697ad,
+	0x00069652,0x00069346,0x00069243,0x00068c8c,0x00068c36,0x00068789,0x00068734,0x0006838c,
+	0x0006828e,0x00068239,0x00068092,0x00067e97,0x00067e43,0x00067d46,0x00067c9e,0x00067b4d,
+	0x000677b3,0x000676b8,0x00067665,0x000674c3,0x00067376,0x000672d0,0x000671d6,0x0006708a,
+	0x00066fe5,0x00066df4,0x00066b0d,0x0006691f,0x000665eb,0x00066547,0x00066452,0x0006635d,
+	0x00066217,0x00066174,0x00066123,0x00065e98,0x00065cb2,0x00065c61,0x00065acd,0x0006598a,
+	0x000657f7,0x000657a7,0x00065706,0x00065615,0x000653e4,0x00065204,0x00064e97,0x00064d59,
+	0x00064904,0x000648b5,0x00064817,0x00064503,0x00064466,0x00064417,0x0006437a,0x00064156,
+	0x00063fcf,0x00063dfb,0x00063dad,0x00063bda,0x0006396d,0x00063920,0x000634e6,0x000633b2,
+	0x00063066,0x00062f34,0x00062e9b,0x00062db6,0x00062cd1,0x00062abc,0x00062a24,0x000628f4,
+	0x0006272d,0x0006264a,0x00062567,0x000624d0,0x000621df,0x00062148,0x00061ea5,0x00061e5a,
+	0x00061c99,0x00061bb9,0x00061b24,0x00061a45,0x0006183c,0x000615a0,0x0006142f,0x00061307,
+	0x00061196,0x00060cff,0x00060c24,0x00060ab7,0x000609dc,0x00060901,0x000608b8,0x000607de,
+	0x00060599,0x000604bf,0x00060477,0x000602c5,0x000601ec,0x0005fdfc,0x0005fdb4,0x0005fc4e,
+	0x0005fb2f,0x0005f8f4,0x0005f81e,0x0005f701,0x0005f62c,0x0005f4c9,0x0005f177,0x0005eeb6,
+	0x0005ed56,0x0005ed10,0x0005ebb1,0x0005eb6b,0x0005e9c7,0x0005e93b,0x0005e86a,0x0005e5b1,
+	0x0005e526,0x0005e4e0,0x0005e340,0x0005e0d1,0x0005df78,0x0005df33,0x0005ddda,0x0005dd95,
+	0x0005dd0c,0x0005da5d,0x0005d83a,0x0005d4c4,0x0005d43c,0x0005d32c,0x0005d261,0x0005d1d9,
+	0x0005d043,0x0005cf79,0x0005ce6b,0x0005ccd7,0x0005cb43,0x0005ca7a,0x0005c9f4,0x0005c8e8,
+	0x0005c609,0x0005c5c7,0x0005c3b2,0x0005c1e2,0x0005c096,0x0005bfd0,0x0005be44,0x0005bcb8,
+	0x0005baec,0x0005ba27,0x0005b9a4,0x0005b716,0x0005b693,0x0005b50c,0x0005b448,0x0005b407,
+	0x0005b344,0x0005b282,0x0005b07b,0x0005af78,0x0005acb2,0x0005ac72,0x0005a8ef,0x0005a7ef,
+	0x0005a72f,0x0005a6af,0x0005a431,0x0005a3b2,0x0005a235,0x00059f3d,0x00059cc6,0x00059c48,
+	0x00059b4c,0x00059a12,0x000599d3,0x000597de,0x000597a0,0x00059629,0x000594b3,0x00059093,
+	0x00059055,0x00058fd9,0x00058f1f,0x00058dad,0x00058cf4,0x00058c3b,0x00058b45,0x00058a8d,
+	0x00058a12,0x000589d5,0x0005891d,0x0005863f,0x000585c5,0x00058364,0x00058234,0x0005817e,
+	0x000580c8,0x00057f21,0x00057ea8,0x00057df3,0x00057d3e,0x00057d02,0x00057b99,0x00057ae5,
+	0x000579b8,0x0005797c,0x00057851,0x0005779e,0x00057549,0x000574d2,0x000571cd,0x00057157,
+	0x0005711b,0x0005706a,0x00056de0,0x00056da5,0x00056ae4,0x00056a6e,0x000569be,0x00056984,
+	0x0005690f,0x0005685f,0x000565a3,0x000564f4,0x0005640b,0x00056397,0x0005635d,0x00055f85,
+	0x00055ed7,0x00055df1,0x00055c25,0x00055acc,0x00055a93,0x00055974,0x0005593b,0x0005581d,
+	0x00055772,0x0005568e,0x0005561c,0x00055538,0x000553e3,0x00055174,0x000550ca,0x00054f3f,
+	0x00054ecf,0x00054bf4,0x00054b83,0x00054b4b,0x000549fb,0x000548e4,0x00054805,0x00054795,
+	0x000546b6,0x00054568,0x000544f9,0x00054375,0x000542cf,0x00054115,0x0005406f,0x00053f93,
+	0x00053f24,0x00053e7f,0x00053dda,0x00053cff,0x00053c5a,0x00053b48,0x00053a00,0x000539ca,
+	0x00053926,0x00053882,0x000536cf,0x000535f5,0x00053552,0x000534b0,0x0005336b,0x0005325d,
+	0x00053227,0x00053185,0x00052fa0,0x00052f34,0x00052e93,0x00052df2,0x00052d51,0x00052c10,
+	0x00052a2f,0x0005295a,0x000528ba,0x000527b0,0x000526dc,0x000524ff,0x00052495,0x00052323,
+	0x00052285,0x000520ab,0x00051fa4,0x00051ed2,0x00051dcc,0x00051c92,0x00051c5e,0x00051bc1,
+	0x00051a88,0x00051950,0x000515ab,0x00051543,0x000514a9,0x000513da,0x00051373,0x000512d9,
+	0x000512a5,0x0005123e,0x00051070,0x00050f3c,0x00050ea3,0x00050dd6,0x00050d3d,0x00050ca4,
+	0x00050c3e,0x00050a74,0x00050a41,0x000509dc,0x000509a9,0x00050749,0x000506e4,0x0005064c,
+	0x000505b5,0x00050454,0x00050163,0x000500cd,0x00050069,0x0004ffd3,0x0004fea7,0x0004fe11,
+	0x0004fc20,0x0004fbbc,0x0004faf6,0x0004fa92,0x0004f9cc,0x0004f938,0x0004f8a3,0x0004f841,
+	0x0004f55d,0x0004f52c,0x0004f437,0x0004f310,0x0004f24c,0x0004f158,0x0004f095,0x0004ee4c,
+	0x0004edba,0x0004ec97,0x0004ec36,0x0004eae3,0x0004ea82,0x0004e9f1,0x0004e9c1,0x0004e71f,
+	0x0004e5cf,0x0004e44f,0x0004e41f,0x0004e301,0x0004e271,0x0004e212,0x0004e036,0x0004df48,
+	0x0004deba,0x0004de2c,0x0004dd9d,0x0004dce0,0x0004dbf4,0x0004dad9,0x0004d98f,0x0004d8a4,
+	0x0004d75c,0x0004d5e5,0x0004d49e,0x0004d3b5,0x0004d26f,0x0004d1e4,0x0004d070,0x0004cfe5,
+	0x0004cf2c,0x0004cea1,0x0004cd30,0x0004cb64,0x0004ca7e,0x0004ca50,0x0004c9c7,0x0004c96b,
+	0x0004c93d,0x0004c8e1,0x0004c7cf,0x0004c7a1,0x0004c6bd,0x0004c68f,0x0004c607,0x0004c412,
+	0x0004c38a,0x0004c35c,0x0004c302,0x0004c16a,0x0004c0b5,0x0004bfd4,0x0004bf1f,0x0004bd30,
+	0x0004bd03,0x0004bc23,0x0004ba90,0x0004b957,0x0004b8fe,0x0004b8d1,0x0004b878,0x0004b6e8,
+	0x0004b6bb,0x0004b662,0x0004b5dd,0x0004b52c,0x0004b44e,0x0004b422,0x0004b18c,0x0004b134,
+	0x0004aea1,0x0004ae75,0x0004ad9a,0x0004ad6e,0x0004abe5,0x0004ab8d,0x0004aa05,0x0004a983,
+	0x0004a853,0x0004a77a,0x0004a74f,0x0004a6f8,0x0004a548,0x0004a241,0x0004a1c0,0x0004a16a,
+	0x0004a0ea,0x00049fbe,0x00049f69,0x00049dbe,0x00049ce9,0x00049bbf,0x000499ed,0x0004996e,
+	0x00049944,0x000496ca,0x000495ce,0x000494fc,0x00049382,0x00049359,0x00049305,0x000491e0,
+	0x00049163,0x00048f99,0x00048e23,0x00048df9,0x00048d00,0x00048c84,0x00048c31,0x00048b8c,
+	0x00048b39,0x00048a94,0x00048a19,0x0004894b,0x00048922,0x0004882b,0x000486ba,0x000485ed,
+	0x000484cf,0x00048389,0x0004826c,0x0004821a,0x000481a0,0x00048127,0x000480fe,0x00048084,
+	0x00048033,0x0004800b,0x00047dd5,0x00047dac,0x00047b79,0x00047b00,0x00047ad8,0x00047a88,
+	0x00047a10,0x000478f7,0x000478a7,0x000477b8,0x000476a0,0x00047562,0x0004744c,0x000473fd,
+	0x00047386,0x000472e7,0x00047271,0x00047222,0x000471ab,0x00047135,0x000470be,0x00047021,
+	0x00046fd2,0x00046f34,0x00046ee6,0x00046dd3,0x00046c99,0x00046bfd,0x00046b88,0x00046b39,
+	0x00046a4f,0x000469b3,0x0004687c,0x00046855,0x00046793,0x000466f8,0x000466ab,0x00046636,
+	0x00046440,0x000463cc,0x0004630c,0x00046272,0x00046225,0x000461b2,0x000460cc,0x00045fc0,
+	0x00045d83,0x00045d37,0x00045c2c,0x00045a8b,0x000459f3,0x00045910,0x000458c4,0x00045853,
+	0x000457bc,0x00045700,0x0004568f,0x00045587,0x000454cc,0x0004545b,0x00045436,0x0004537a,
+	0x0004529a,0x000451ba,0x000450b5,0x00045045,0x00044fd6,0x00044e87,0x00044dce,0x00044d5f,
+	0x00044ccb,0x00044b7f,0x00044b35,0x00044ac6,0x00044aa1,0x00044a33,0x0004497b,0x00044956,
+	0x0004489f,0x0004480c,0x0004479e,0x00044730,0x00044679,0x00044655,0x0004450c,0x00044456,
+	0x00044432,0x00044357,0x0004430f,0x000442a2,0x00044211,0x0004415b,0x00044082,0x00043f85,
+	0x00043ead,0x00043e65,0x00043dd5,0x00043d21,0x00043cb5,0x00043c4a,0x00043ae3,0x00043a9c,
+	0x000439a2,0x00043884,0x0004378b,0x000436d9,0x0004364b,0x0004359a,0x000434c6,0x000434a2,
+	0x00043364,0x000432fa,0x00043227,0x00043177,0x000430a4,0x00043081,0x0004303b,0x00043018,
+	0x00042f46,0x00042edd,0x00042e97,0x00042e0b,0x00042dc5,0x00042ac7,0x00042a81,0x00042a5e,
+	0x00042a19,0x000429f6,0x00042949,0x0004287a,0x00042812,0x000427aa,0x000426b9,0x00042674,
+	0x0004260c,0x000425a5,0x0004253e,0x000424b5,0x0004244e,0x000421e6,0x000420b3,0x0004206e,
+	0x00042008,0x00041fe6,0x00041f1a,0x00041eb4,0x00041e4f,0x00041de9,0x00041da5,0x00041cb8,
+	0x00041b45,0x00041a7a,0x00041a59,0x0004192a,0x00041882,0x0004181e,0x0004166a,0x000414da,
+	0x00041497,0x00041476,0x00041434,0x00041412,0x000413d0,0x000412e7,0x000412a5,0x00041241,
+	0x000411de,0x0004115a,0x00041051,0x00040f8b,0x00040f6a,0x00040cb7,0x00040c76,0x00040c55,
+	0x00040c14,0x00040a8b,0x00040a29,0x000409c7,0x000409a7,0x00040881,0x00040840,0x0004075d,
+	0x000406fc,0x00040536,0x00040414,0x00040332,0x000402d1,0x00040231,0x00040170,0x00040150,
+	0x000400f0,0x00040030,0x0003fe50,0x0003fdf1,0x0003fdb1,0x0003fd51,0x0003fcf2,0x0003fc13,
+	0x0003fbd4,0x0003fbb4,0x0003fa38,0x0003f9f9,0x0003f99a,0x0003f93b,0x0003f7a1,0x0003f704,
+	0x0003f5e9,0x0003f58b,0x0003f50e,0x0003f4b0,0x0003f452,0x0003f27e,0x0003f23f,0x0003f185,
+	0x0003f0ca,0x0003f0ab,0x0003efb3,0x0003ef94,0x0003ef37,0x0003eef9,0x0003ee40,0x0003ed2a,
+	0x0003ed0b,0x0003ecaf,0x0003ec71,0x0003eae1,0x0003ea29,0x0003e9cd,0x0003e916,0x0003e8d9,
+	0x0003e76a,0x0003e5fd,0x0003e547,0x0003e4ec,0x0003e4cd,0x0003e418,0x0003e270,0x0003e1f8,
+	0x0003e1bb,0x0003e161,0x0003e0ad,0x0003e08e,0x0003df80,0x0003df26,0x0003deea,0x0003de90,
+	0x0003de37,0x0003dd0c,0x0003dc1d,0x0003dbff,0x0003dba6,0x0003db4d,0x0003da41,0x0003d9ad,
+	0x0003d954,0x0003d936,0x0003d8fb,0x0003d885,0x0003d82c,0x0003d7d3,0x0003d671,0x0003d586,
+	0x0003d52e,0x0003d4b8,0x0003d426,0x0003d3ce,0x0003d301,0x0003d1c0,0x0003d14b,0x0003d062,
+	0x0003d00b,0x0003cfee,0x0003cf3f,0x0003cf05,0x0003cee8,0x0003cdaa,0x0003cd36,0x0003cc32,
+	0x0003ca49,0x0003ca2c,0x0003c9d6,0x0003c8d4,0x0003c89b,0x0003c845,0x0003c7ef,0x0003c77d,
+	0x0003c6ee,0x0003c67c,0x0003c57b,0x0003c526,0x0003c4ed,0x0003c4d1,0x0003c498,0x0003c427,
+	0x0003c344,0x0003c327,0x0003c27e,0x0003c1d4,0x0003c180,0x0003c082,0x0003c04a,0x0003bff5,
+	0x0003bfa1,0x0003bf4d,0x0003bf30,0x0003bedc,0x0003be34,0x0003bda8,0x0003bc90,0x0003bbe9,
+	0x0003baee,0x0003bab7,0x0003ba63,0x0003ba47,0x0003b969,0x0003b94e,0x0003b8c3,0x0003b801,
+	0x0003b7ca,0x0003b62c,0x0003b610,0x0003b587,0x0003b4e2,0x0003b4c6,0x0003b37d,0x0003b32b,
+	0x0003b250,0x0003b1e3,0x0003b15a,0x0003b13f,0x0003b09c,0x0003af70,0x0003af1f,0x0003af04,
+	0x0003ae2b,0x0003ad1c,0x0003ac95,0x0003ac7a,0x0003abd8,0x0003ab37,0x0003aa45,0x0003a9bf,
+	0x0003a91e,0x0003a8cd,0x0003a8b2,0x0003a82d,0x0003a812,0x0003a7c2,0x0003a73c,0x0003a64c,
+	0x0003a632,0x0003a592,0x0003a542,0x0003a50d,0x0003a4bd,0x0003a4a3,0x0003a365,0x0003a1f3,
+	0x0003a1d8,0x0003a1a3,0x0003a189,0x0003a105,0x0003a0eb,0x0003a018,0x00039f7b,0x00039f12,
+	0x00039df2,0x00039dd8,0x00039d89,0x00039d55,0x00039d3b,0x00039cb8,0x00039c6a,0x00039b65,
+	0x00039ac9,0x00039a47,0x000399e0,0x00039944,0x000398f6,0x000398a9,0x0003985b,0x00039828,
+	0x0003973f,0x00039725,0x000396f2,0x00039657,0x00039570,0x00039556,0x000394bc,0x0003946f,
+	0x0003943c,0x00039423,0x00039356,0x000392bd,0x00039223,0x00039171,0x0003913e,0x000390d8,
+	0x00038ff4,0x00038fc1,0x00038f29,0x00038e78,0x00038e2c,0x00038de0,0x00038dad,0x00038d48,
+	0x00038cfd,0x00038cca,0x00038bcf,0x00038b38,0x00038aba,0x00038a0b,0x000389d9,0x000389c0,
+	0x000388f8,0x000388df,0x00038849,0x000386d3,0x000386a1,0x00038657,0x0003852d,0x00038435,
+	0x0003830d,0x00038292,0x0003822f,0x0003819b,0x00038121,0x0003808d,0x00038044,0x00037fb1,
+	0x00037f1e,0x00037ed5,0x00037e73,0x00037db0,0x00037d05,0x00037cbc,0x00037c8c,0x00037c43,
+	0x00037a8e,0x0003799c,0x00037924,0x000377ba,0x0003772a,0x00037712,0x000376e2,0x000376ca,
+	0x0003757b,0x000374eb,0x00037444,0x000373fd,0x000372f7,0x00037297,0x00037268,0x00037192,
+	0x0003714b,0x000370a5,0x00036fd0,0x00036fa1,0x00036f5a,0x00036f43,0x00036efc,0x00036d6c,
+	0x00036c99,0x00036c81,0x00036bc6,0x00036b80,0x00036aad,0x00036a96,0x0003697e,0x00036950,
+	0x00036938,0x000368f3,0x00036867,0x00036821,0x00036796,0x00036722,0x000366c6,0x00036680,
+	0x000365c8,0x0003653d,0x000364e1,0x0003646e,0x000363cd,0x00036202,0x000361bd,0x000361a7,
+	0x00036162,0x00036134,0x000360ab,0x0003600c,0x00035fde,0x00035fc7,0x00035f9a,0x00035f83,
+	0x00035f56,0x00035efb,0x00035eb7,0x00035e45,0x00035e01,0x00035dbd,0x00035da6,0x00035d62,
+	0x00035d1e,0x00035cdb,0x00035c53,0x00035c0f,0x00035b01,0x00035a90,0x00035a7a,0x00035a09,
+	0x000359c6,0x0003593f,0x000358fc,0x000358b9,0x0003581c,0x000357d9,0x00035796,0x00035553,
+	0x00035475,0x00035432,0x000353c3,0x000353ad,0x0003533f,0x000352e6,0x00035278,0x000351f3,
+	0x0003516f,0x00035159,0x00035117,0x000350eb,0x00035051,0x00034fa2,0x00034f4a,0x00034ec7,
+	0x00034e85,0x00034d95,0x00034d7f,0x00034d12,0x00034cbb,0x00034c7a,0x00034b8a,0x00034b75,
+	0x00034a86,0x00034a45,0x000349ef,0x00034982,0x00034901,0x0003487f,0x0003486a,0x000347fe,
+	0x000347be,0x0003473d,0x00034727,0x000346fc,0x00034666,0x000345fb,0x000345e5,0x000345a5,
+	0x000344e4,0x000344ba,0x0003443a,0x000343e4,0x00034324,0x000342a5,0x00034265,0x00034225,
+	0x000341fb,0x000341bb,0x0003417c,0x000340e7,0x000340bd,0x000340a8,0x00034029,0x00033faa,
+	0x00033f80,0x00033f41,0x00033e83,0x00033dc6,0x00033d48,0x00033d33,0x00033c8b,0x00033c0d,
+	0x00033bba,0x00033afe,0x00033a96,0x00033987,0x0003395d,0x0003391f,0x000338cc,0x0003388e,
+	0x0003384f,0x00033826,0x00033811,0x000337aa,0x000336db,0x000336b1,0x00033673,0x00033621,
+	0x000335f8,0x0003352a,0x000334c3,0x000334ae,0x00033351,0x0003333d,0x00033314,0x0003321f,
+	0x0003320a,0x00033190,0x00033115,0x000330b0,0x00033073,0x0003305e,0x00032fe4,0x00032eb4,
+	0x00032e77,0x00032dfe,0x00032d5c,0x00032ce3,0x00032ccf,0x00032bf1,0x00032b3c,0x00032ac4,
+	0x00032a38,0x000329d4,0x000329c0,0x00032948,0x000328d0,0x000328a8,0x00032894,0x0003286c,
+	0x00032830,0x000327b9,0x000327a5,0x00032706,0x00032653,0x0003263f,0x000324b3,0x00032464,
+	0x000323c6,0x0003238b,0x0003233c,0x000322da,0x000322c6,0x0003229f,0x000321ee,0x000321a0,
+	0x0003213e,0x000320ef,0x0003207a,0x00032053,0x00031fa3,0x00031f8f,0x00031ee0,0x00031e7f,
+	0x00031e6b,0x00031e44,0x00031e31,0x00031e0a,0x00031dbc,0x00031cad,0x00031c99,0x00031c5f,
+	0x00031b8b,0x00031b17,0x00031add,0x00031a56,0x000319a9,0x00031982,0x00031949,0x000318fc,
+	0x000318c2,0x00031889,0x00031829,0x000317dd,0x000317b6,0x000317a3,0x000316f7,0x00031698,
+	0x0003165f,0x000315a0,0x000314cf,0x00031483,0x0003144a,0x0003132e,0x00031308,0x000312f5,
+	0x000312d0,0x00031226,0x000311ed,0x000310d3,0x000310c0,0x0003109a,0x0003104f,0x00031017,
+	0x00030ff2,0x00030fb9,0x00030f49,0x00030ec6,0x00030d89,0x00030d06,0x00030cce,0x00030ca9,
+	0x00030c96,0x00030c5f,0x00030c3a,0x00030bb8,0x00030b92,0x00030b80,0x00030b48,0x00030a45,
+	0x00030a33,0x00030a0e,0x000309d6,0x0003098d,0x00030930,0x0003091e,0x000308c2,0x000308af,
+	0x00030853,0x00030841,0x0003081c,0x00030709,0x000306f7,0x00030689,0x0003061b,0x000305bf,
+	0x0003051b,0x000304ae,0x0003042e,0x000303d3,0x000303c1,0x00030354,0x0003031e,0x000302c3,
+	0x0003028d,0x0003020e,0x000301a1,0x0003017d,0x000300ff,0x000300db,0x00030039,0x00030027,
+	0x0002ffcd,0x0002ff85,0x0002ff61,0x0002ff19,0x0002febf,0x0002fe53,0x0002fdb2,0x0002fd11,
+	0x0002fcca,0x0002fc94,0x0002fbf4,0x0002fb66,0x0002fae9,0x0002fab4,0x0002fa7f,0x0002fa26,
+	0x0002f9aa,0x0002f987,0x0002f952,0x0002f940,0x0002f8d6,0x0002f86c,0x0002f849,0x0002f814,
+	0x0002f7df,0x0002f775,0x0002f763,0x0002f6d7,0x0002f6c5,0x0002f65c,0x0002f627,0x0002f604,
+	0x0002f589,0x0002f555,0x0002f532,0x0002f520,0x0002f4b8,0x0002f41a,0x0002f3f8,0x0002f2be,
+	0x0002f222,0x0002f1ba,0x0002f152,0x0002f140,0x0002f11e,0x0002f10c,0x0002f0ea,0x0002f0a5,
+	0x0002f03d,0x0002f01a,0x0002eee4,0x0002eeb1,0x0002ee16,0x0002ee05,0x0002ed9e,0x0002ed48,
+	0x0002ed15,0x0002ecae,0x0002ebe1,0x0002eb9d,0x0002eb6a,0x0002eb37,0x0002eaae,0x0002ea48,
+	0x0002ea37,0x0002e99e,0x0002e94a,0x0002e8a0,0x0002e84c,0x0002e83b,0x0002e808,0x0002e770,
+	0x0002e74e,0x0002e73e,0x0002e5ed,0x0002e5bb,0x0002e5aa,0x0002e524,0x0002e513,0x0002e4f1,
+	0x0002e4ae,0x0002e418,0x0002e3c4,0x0002e360,0x0002e32e,0x0002e31d,0x0002e2ca,0x0002e288,
+	0x0002e266,0x0002e234,0x0002e1d1,0x0002e1c0,0x0002e16d,0x0002e0d8,0x0002e095,0x0002e064,
+	0x0002e043,0x0002df9d,0x0002df7c,0x0002df4b,0x0002de22,0x0002ddf1,0x0002dde1,0x0002dd8e,
+	0x0002dd5d,0x0002dc98,0x0002dc67,0x0002dbf5,0x0002db72,0x0002db41,0x0002daae,0x0002da9e,
+	0x0002da4d,0x0002d9aa,0x0002d959,0x0002d918,0x0002d8e7,0x0002d8c7,0x0002d896,0x0002d886,
+	0x0002d835,0x0002d825,0x0002d7c4,0x0002d7a4,0x0002d793,0x0002d773,0x0002d733,0x0002d6e2,
+	0x0002d6b2,0x0002d651,0x0002d5c0,0x0002d550,0x0002d4ef,0x0002d46f,0x0002d42f,0x0002d3ff,
+	0x0002d37f,0x0002d33f,0x0002d31f,0x0002d30f,0x0002d2e0,0x0002d250,0x0002d191,0x0002d102,
+	0x0002d0b3,0x0002d054,0x0002d044,0x0002d025,0x0002cfb6,0x0002cf67,0x0002cf38,0x0002cf08,
+	0x0002ced9,0x0002ce4b,0x0002cded,0x0002cddd,0x0002cd01,0x0002cc74,0x0002cc06,0x0002cb89,
+	0x0002cb2b,0x0002cabe,0x0002ca03,0x0002c9a6,0x0002c8fb,0x0002c8cd,0x0002c8bd,0x0002c870,
+	0x0002c832,0x0002c813,0x0002c803,0x0002c7e4,0x0002c778,0x0002c71c,0x0002c6ed,0x0002c6cf,
+	0x0002c6a0,0x0002c634,0x0002c616,0x0002c606,0x0002c5e8,0x0002c501,0x0002c4d3,0x0002c4c4,
+	0x0002c496,0x0002c449,0x0002c43a,0x0002c355,0x0002c2ad,0x0002c29e,0x0002c27f,0x0002c251,
+	0x0002c215,0x0002c1e7,0x0002c1b9,0x0002c140,0x0002c0e5,0x0002c08a,0x0002c05c,0x0002c020,
+	0x0002c002,0x0002bff2,0x0002bf3d,0x0002bee3,0x0002bec4,0x0002be97,0x0002be5b,0x0002be2e,
+	0x0002be01,0x0002bdb6,0x0002bda7,0x0002bd7a,0x0002bd1f,0x0002bc4e,0x0002bbe5,0x0002bbb8,
+	0x0002bb9a,0x0002bb41,0x0002bb05,0x0002bad8,0x0002ba7f,0x0002ba61,0x0002ba34,0x0002b9cc,
+	0x0002b9a0,0x0002b947,0x0002b8fd,0x0002b8d0,0x0002b8a4,0x0002b868,0x0002b83c,0x0002b810,
+	0x0002b7f2,0x0002b7e3,0x0002b7c6,0x0002b78b,0x0002b732,0x0002b715,0x0002b6ae,0x0002b629,
+	0x0002b5e0,0x0002b5d1,0x0002b55b,0x0002b52f,0x0002b49d,0x0002b471,0x0002b428,0x0002b3ed,
+	0x0002b3d0,0x0002b2f5,0x0002b1f0,0x0002b198,0x0002b15e,0x0002b0bf,0x0002b068,0x0002b05a,
+	0x0002b02e,0x0002afd8,0x0002af64,0x0002af39,0x0002af0e,0x0002aeff,0x0002ae7e,0x0002ae61,
+	0x0002ada6,0x0002ad8a,0x0002ad50,0x0002accf,0x0002ac88,0x0002ac4f,0x0002ac07,0x0002abdc,
+	0x0002ab79,0x0002ab5c,0x0002aace,0x0002aa31,0x0002a9b2,0x0002a95d,0x0002a924,0x0002a85e,
+	0x0002a809,0x0002a7df,0x0002a7b5,0x0002a77c,0x0002a752,0x0002a6fd,0x0002a655,0x0002a5e5,
+	0x0002a582,0x0002a566,0x0002a504,0x0002a4b1,0x0002a487,0x0002a441,0x0002a3ed,0x0002a362,
+	0x0002a338,0x0002a31c,0x0002a2e5,0x0002a268,0x0002a214,0x0002a198,0x0002a152,0x0002a145,
+	0x0002a129,0x0002a09f,0x0002a05a,0x00029ff9,0x00029fde,0x00029fb4,0x00029fa7,0x00029f62,
+	0x00029ebd,0x00029e41,0x00029e34,0x00029e18,0x00029d8f,0x00029d22,0x00029cc2,0x00029c7e,
+	0x00029c1f,0x00029bf6,0x00029bdb,0x00029bb2,0x00029b2a,0x00029b01,0x00029abd,0x00029a95,
+	0x00029a87,0x00029a36,0x00029a0d,0x00029942,0x000298ff,0x000298c9,0x000298a0,0x00029885,
+	0x0002985d,0x00029827,0x0002971a,0x0002970d,0x000296f2,0x000296e5,0x00029694,0x0002961c,
+	0x00029601,0x000295d9,0x000295a3,0x00029561,0x00029539,0x000294c1,0x00029449,0x0002943c,
+	0x000293ec,0x00029381,0x0002934c,0x00029325,0x0002930a,0x000292e2,0x000292bb,0x000292ad,
+	0x00029156,0x000290fa,0x000290df,0x0002905c,0x00028ff3,0x00028fe5,0x00028fcb,0x00028fa4,
+	0x00028f55,0x00028f48,0x00028f21,0x00028ed2,0x00028e84,0x00028e5c,0x00028e42,0x00028de7,
+	0x00028da6,0x00028d7f,0x00028d58,0x00028cfc,0x00028cbb,0x00028c60,0x00028bf9,0x00028bc5,
+	0x00028b9e,0x00028b50,0x00028b36,0x00028b02,0x00028a74,0x00028a4e,0x00028a41,0x000289cd,
+	0x0002893f,0x00028918,0x0002890c,0x00028898,0x00028871,0x0002880b,0x000287b1,0x00028771,
+	0x0002874b,0x000286fe,0x000286f1,0x000286cb,0x000286b1,0x0002867e,0x0002860c,0x000285bf,
+	0x0002855a,0x0002854d,0x00028533,0x000284db,0x000284c1,0x0002848f,0x00028442,0x000283f6,
+	0x00028339,0x000282d4,0x000282a2,0x00028288,0x0002827c,0x00028256,0x000281cc,0x00028180,
+	0x0002814e,0x0002810f,0x000280ea,0x000280c4,0x0002809e,0x00028047,0x00028021,0x00027fb1,
+	0x00027f72,0x00027f28,0x00027f1b,0x00027edd,0x00027ed0,0x00027eb7,0x00027e16,0x00027dfd,
+	0x00027db2,0x00027d81,0x00027d68,0x00027cf8,0x00027cc7,0x00027c89,0x00027c33,0x00027bd0,
+	0x00027bab,0x00027b86,0x00027b55,0x00027b17,0x00027af2,0x00027ac1,0x00027a9c,0x00027a52,
+	0x00027a15,0x0002799a,0x0002795d,0x0002792c,0x00027914,0x000278ca,0x0002782c,0x000277be,
+	0x000277a6,0x0002775c,0x000276ef,0x000276cb,0x00027615,0x000275f0,0x000275c0,0x0002759c,
+	0x00027517,0x000274ce,0x000274c2,0x000274aa,0x00027486,0x00027462,0x00027456,0x00027419,
+	0x0002740d,0x000273f5,0x000273d1,0x000273ad,0x000273a1,0x0002737d,0x000272f9,0x0002728d,
+	0x00027269,0x000271fd,0x000271b6,0x00027186,0x0002713e,0x0002711b,0x000270df,0x00027098,
+	0x0002708c,0x0002702c,0x00027021,0x00026fe5,0x00026fd9,0x00026f9e,0x00026f33,0x00026f10,
+	0x00026e99,0x00026e82,0x00026e76,0x00026e52,0x00026dd0,0x00026dad,0x00026d8a,0x00026d20,
+	0x00026cfc,0x00026caa,0x00026c63,0x00026c06,0x00026bfa,0x00026bd7,0x00026bb3,0x00026b9c,
+	0x00026b4a,0x00026b04,0x00026aec,0x00026ae1,0x00026a78,0x00026a1a,0x00026949,0x00026903,
+	0x000268e0,0x0002688f,0x000267ed,0x000267e1,0x0002679c,0x00026779,0x00026734,0x00026711,
+	0x000266fa,0x000266ee,0x00026692,0x000265e5,0x000265b7,0x0002652e,0x0002650b,0x0002645f,
+	0x00026426,0x0002641b,0x000263b4,0x0002639d,0x0002637b,0x00026336,0x00026309,0x0002628b,
+	0x00026280,0x0002625e,0x000261e1,0x0002617b,0x00026170,0x00026137,0x0002612c,0x000260f3,
+	0x00026049,0x0002603e,0x00025fa0,0x00025f7e,0x00025f30,0x00025ed6,0x00025eb4,0x00025e44,
+	0x00025dea,0x00025ddf,0x00025dbd,0x00025da7,0x00025cf4,0x00025cde,0x00025cd2,0x00025cbc,
+	0x00025c9b,0x00025c90,0x00025c4d,0x00025c36,0x00025c15,0x00025bf4,0x00025bb1,0x00025ba6,
+	0x00025b84,0x00025b6e,0x00025b4d,0x00025b20,0x00025aff,0x00025ae9,0x00025a7a,0x00025a64,
+	0x000259b3,0x0002597c,0x0002594f,0x000258f7,0x000258ec,0x00025873,0x00025868,0x00025852,
+	0x00025831,0x00025805,0x000257e4,0x0002578c,0x00025740,0x0002572a,0x000256c7,0x0002569b,
+	0x00025686,0x00025618,0x000255f8,0x000255b6,0x00025575,0x00025554,0x0002551e,0x00025513,
+	0x000254dc,0x000254d2,0x00025490,0x000253f8,0x000253b7,0x00025356,0x0002534b,0x000252ea,
+	0x000252b4,0x00025289,0x00025253,0x00025151,0x00025146,0x00025130,0x00025110,0x000250e5,
+	0x000250b0,0x000250a5,0x0002506f,0x00024fcf,0x00024fc4,0x00024f04,0x00024ee4,0x00024eaf,
+	0x00024e8f,0x00024e84,0x00024e24,0x00024e0f,0x00024def,0x00024dc5,0x00024d70,0x00024d26,
+	0x00024cd1,0x00024cb1,0x00024c67,0x00024c52,0x00024be9,0x00024bd4,0x00024bb4,0x00024ba9,
+	0x00024b75,0x00024b36,0x00024b2b,0x00024b0c,0x00024acc,0x00024aad,0x00024a8d,0x00024a78,
+	0x00024a39,0x00024a2f,0x00024a10,0x000249fb,0x000249bc,0x0002499c,0x00024972,0x0002495e,
+	0x00024953,0x00024934,0x000248d6,0x000248a2,0x00024882,0x00024859,0x0002481a,0x000247fb,
+	0x00024788,0x0002477e,0x0002475f,0x00024721,0x000246c3,0x000246af,0x00024666,0x00024647,
+	0x00024632,0x000245cb,0x000245ac,0x00024559,0x00024530,0x0002451c,0x000244f2,0x00024481,
+	0x00024458,0x0002441a,0x000243fc,0x000243dd,0x0002438b,0x0002434d,0x000242f1,0x00024258,
+	0x0002422f,0x0002421b,0x00024210,0x000241fc,0x000241dd,0x00024159,0x00024145,0x000240fe,
+	0x00024084,0x00024014,0x00023ff6,0x00023fec,0x00023fcd,0x00023f9b,0x00023f7d,0x00023f36,
+	0x00023f18,0x00023ef9,0x00023ebd,0x00023e8a,0x00023e6c,0x00023e62,0x00023e26,0x00023df3,
+	0x00023db7,0x00023d8f,0x00023d35,0x00023cda,0x00023ca8,0x00023c8a,0x00023c62,0x00023c12,
+	0x00023bf5,0x00023bd7,0x00023baf,0x00023b5f,0x00023afb,0x00023ae7,0x00023ade,0x00023aac,
+	0x00023aa2,0x00023a70,0x00023a35,0x00023a17,0x000239ef,0x000239d1,0x000239a0,0x0002393d,
+	0x0002390c,0x000238b3,0x00023832,0x0002381f,0x00023801,0x0002376e,0x00023764,0x00023750,
+	0x00023729,0x0002370c,0x000236d1,0x00023696,0x0002363e,0x0002362a,0x00023603,0x00023598,
+	0x0002357a,0x00023571,0x00023536,0x00023490,0x00023473,0x0002341c,0x000233e2,0x000233c4,
+	0x000233bb,0x00023333,0x000232ef,0x000232a2,0x0002325e,0x0002324b,0x00023208,0x000231ce,
+	0x000231bb,0x0002319e,0x00023181,0x00023177,0x000230ca,0x000230b7,0x0002309a,0x0002303a,
+	0x00023001,0x00022f8e,0x00022f72,0x00022f09,0x00022eff,0x00022eb3,0x00022e5d,0x00022e24,
+	0x00022deb,0x00022d96,0x00022d8c,0x00022d70,0x00022d53,0x00022d37,0x00022d24,0x00022d07,
+	0x00022cc5,0x00022cb2,0x00022ca9,0x00022c41,0x00022c1b,0x00022be2,0x00022bc6,0x00022b97,
+	0x00022b7b,0x00022b55,0x00022b1d,0x00022ac8,0x00022a90,0x00022a74,0x00022a45,0x00022a3b,
+	0x000229d4,0x00022993,0x00022977,0x0002295b,0x00022948,0x000228f4,0x000228d8,0x0002287b,
+	0x00022814,0x0002280b,0x000227d3,0x00022764,0x00022751,0x000226fe,0x000226ab,0x000226a1,
+	0x0002263c,0x00022632,0x00022620,0x000225e9,0x000225c4,0x0002258c,0x0002255e,0x0002251e,
+	0x0002250b,0x00022502,0x000224af,0x00022466,0x000223b8,0x0002239c,0x00022381,0x00022366,
+	0x0002232f,0x00022301,0x000222e6,0x000222af,0x0002228a,0x0002226f,0x0002225d,0x00022241,
+	0x00022202,0x00022179,0x0002215e,0x00022131,0x0002210d,0x000220a9,0x0002208e,0x0002206a,
+	0x00022033,0x00022006,0x00021ffd,0x00021fd0,0x00021fc7,0x00021fac,0x00021f7f,0x00021f76,
+	0x00021f49,0x00021f13,0x00021ec2,0x00021e68,0x00021e4d,0x00021e3b,0x00021e17,0x00021db5,
+	0x00021d9a,0x00021d7f,0x00021cf9,0x00021cde,0x00021ca0,0x00021c85,0x00021c4f,0x00021c1a,
+	0x00021bff,0x00021bd3,0x00021bca,0x00021b9d,0x00021b18,0x00021b0f,0x00021ac8,0x00021aa5,
+	0x00021a93,0x00021a8a,0x00021a70,0x00021a20,0x00021a0f,0x00021a06,0x000219eb,0x000219da,
+	0x00021967,0x00021955,0x00021932,0x00021918,0x000218ec,0x000218e3,0x000218d1,0x000218b7,
+	0x00021894,0x00021882,0x00021868,0x000217e4,0x000217b0,0x000217a7,0x0002178d,0x00021772,
+	0x00021761,0x00021709,0x000216a9,0x00021687,0x00021675,0x0002166c,0x0002165b,0x00021522,
+	0x000214ff,0x000214ee,0x000214cb,0x0002146c,0x00021463,0x00021452,0x00021416,0x000213ea,
+	0x000213e2,0x000213d1,0x0002137a,0x00021360,0x00021335,0x000212e8,0x000212ce,0x00021278,
+	0x00021233,0x0002121a,0x000211f7,0x000211de,0x000211cd,0x00021177,0x00021144,0x000210e6,
+	0x000210dd,0x000210cc,0x000210c4,0x00021090,0x00021066,0x00021019,0x00021011,0x00020fb3,
+	0x00020f9a,0x00020f4d,0x00020ece,0x00020ec6,0x00020e9b,0x00020e60,0x00020e36,0x00020e14,
+	0x00020dd0,0x00020cfe,0x00020ce5,0x00020cbb,0x00020c99,0x00020c6f,0x00020c3d,0x00020c23,
+	0x00020bd8,0x00020bd0,0x00020b74,0x00020b5b,0x00020b52,0x00020b42,0x00020b28,0x00020b07,
+	0x00020aee,0x00020ad5,0x00020aab,0x00020a60,0x00020a58,0x000209fc,0x000209f4,0x000209b2,
+	0x00020978,0x0002094e,0x00020935,0x0002092d,0x000208fb,0x000208d2,0x0002087f,0x0002086e
+} ;
+
+
+// group traversal order for the depth-bounded _rest loops: base lane
+// indexes of the 64-prime groups, greedily sorted so each successive
+// 64-byte block maximizes the marginal rejection rate 1 - prod(1-1/p)
+// over the groups still unvisited.  for the canonical ascending
+// firstprimes[] the greedy order IS the identity -- smaller primes
+// always reject more -- so this is a no-op indirection today; it is
+// tabulated so a non-canonical layout reorders traversal in one
+// place.  storage stays canonical either way, so survivors never need
+// a permutation index when reported
+
+static const
+__attribute__((aligned(64)))
+//
+uint16_t firstprimes_grouporder_simd[54] = {
+	0x0000,0x0040,0x0080,0x00c0,0x0100,0x0140,0x0180,0x01c0,0x0200,0x0240,0x0280,0x02c0,0x0300,0x0340,0x0380,0x03c0,
+	0x0400,0x0440,0x0480,0x04c0,0x0500,0x0540,0x0580,0x05c0,0x0600,0x0640,0x0680,0x06c0,0x0700,0x0740,0x0780,0x07c0,
+	0x0800,0x0840,0x0880,0x08c0,0x0900,0x0940,0x0980,0x09c0,0x0a00,0x0a40,0x0a80,0x0ac0,0x0b00,0x0b40,0x0b80,0x0bc0,
+	0x0c00,0x0c40,0x0c80,0x0cc0,0x0d00,0x0d40
+} ;
+
+
+// packed 8-bit copies for the first 32 primes [5..139], doubling lane
+// density for the front-filter group; all three tables are the uint8_t
+// equivalents of the corresponding ..._simd[] tables above, with the
+// reduction threshold at 0xc0 instead of 0x8000 (mod2range entries
+// add the largest prime multiple <= 0xc0, negated mod 2^8)
+
+static const
+__attribute__((aligned(64)))
+//
+uint8_t firstprimes8_inverse_simd[32] = {
+	0xcd, 0xb7, 0xa3, 0xc5, 0xf1, 0x1b, 0xa7, 0x35, 0xdf, 0xad, 0x19, 0x83, 0xcf, 0x1d, 0xf3, 0x15,
+	0x6b, 0x77, 0xf9, 0xaf, 0xdb, 0xe9, 0xa1, 0x6d, 0x57, 0x43, 0x65, 0x91, 0x7f, 0x2b, 0xb9, 0x23
+} ;
+
+
+static const
+__attribute__((aligned(64)))
+//
+uint8_t firstprimes8_mullimit_simd[32] = {
+	0x33, 0x24, 0x17, 0x13, 0x0f, 0x0d, 0x0b, 0x08, 0x08, 0x06, 0x06, 0x05, 0x05, 0x04, 0x04, 0x04,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01
+} ;
+
+
+static const
+__attribute__((aligned(64)))
+//
+uint8_t firstprimes8_mod2range_simd[32] = {
+	0x42, 0x43, 0x45, 0x4a, 0x45, 0x42, 0x48, 0x52, 0x46, 0x47, 0x5c, 0x54, 0x44, 0x61, 0x4f, 0x49,
+	0x7a, 0x72, 0x6e, 0x62, 0x5a, 0x4e, 0x9f, 0x9b, 0x99, 0x95, 0x93, 0x8f, 0x81, 0x7d, 0x77, 0x75
+} ;
 #endif   /* USE_SIMD */
 
 #endif   /* !SF__FIRSTPRIMES */
@@ -0,0 +1,174 @@
+/*------------------------------------------------------------------------
+ * primality search: single-header embedding of the SIMD trial divisions
+ *------------------------------------------------------------------------
+ * SPDX: MIT
+ *------------------------------------------------------------------------
+ * Author: Tamas Visegrady  <tamas@visegrady.ch>
+ *----------------------------------------------------------------------*/
+
+/* the "essentially inlined version to be used by applications": include
+ * this header from exactly ONE translation unit of the embedder.  it
+ * pulls in simdprime.c with the standalone drivers compiled out
+ * (SIMDDIVIDE_EMBED), so everything below the simddivide_...() entry
+ * points is static in the including TU and inherits the embedder's
+ * -O/-march/LTO flags, as promised in the README.
+ *
+ * the trial-division depth is fixed at COMPILE time; define, before
+ * including,
+ *     SIMDDIVIDE_TABLE  'S'     -- 576 primes
+ *     SIMDDIVIDE_TABLE  'M'     -- 1856 primes
+ *     SIMDDIVIDE_TABLE  'L'     -- 3456 primes (default)
+ * and the runtime S/M/L mode dispatch of the standalone tool constant-
+ * folds away.  this is measurable with the 'S' table, where a full
+ * check is only 9 groups of work.  SIMDPRIME_COUNT_CUSTOM builds keep
+ * the generated depth; SIMDDIVIDE_TABLE is then ignored.
+ *
+ * the NO_SIMD_... feature knobs of simdprime.c apply unchanged; see
+ * the list there.  SIMD_BENCH does not combine with embedding.
+ */
+
+#if !defined(SF__SIMDDIVIDE)
+#define  SF__SIMDDIVIDE  1
+
+#if defined(SIMD_BENCH)
+#error "SIMD_BENCH and embedding (simddivide.h) do not combine"
+#endif
+
+#if !defined(SIMDDIVIDE_TABLE)
+#define  SIMDDIVIDE_TABLE  'L'
+#endif
+
+		// compile-time table selection: prohibiting the larger
+		// sizes collapses set_default_table_size() and
+		// simd_has_no_factor_w() to the chosen depth
+#if !defined(SIMDPRIME_COUNT_CUSTOM)
+#if (SIMDDIVIDE_TABLE == 'S')
+#if !defined(NO_SIMDDIVIDE_M)
+#define  NO_SIMDDIVIDE_M  1
+#endif
+#if !defined(NO_SIMDDIVIDE_L)
+#define  NO_SIMDDIVIDE_L  1
+#endif
+
+#elif (SIMDDIVIDE_TABLE == 'M')
+#if !defined(NO_SIMDDIVIDE_L)
+#define  NO_SIMDDIVIDE_L  1
+#endif
+
+#elif (SIMDDIVIDE_TABLE != 'L')
+#error "unknown SIMDDIVIDE_TABLE; define as 'S', 'M' or 'L'"
+#endif
+#endif   // !SIMDPRIME_COUNT_CUSTOM
+
+#define  SIMDDIVIDE_EMBED  1
+//
+#include "simdprime.c"
+
+		// primes per full-depth check; compile-time constant
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+#define  SIMDDIVIDE_PRIMES  ((unsigned int) SIMDPRIME_COUNT_CUSTOM)
+#elif (SIMDDIVIDE_TABLE == 'S')
+#define  SIMDDIVIDE_PRIMES  ((unsigned int) 576)
+#elif (SIMDDIVIDE_TABLE == 'M')
+#define  SIMDDIVIDE_PRIMES  ((unsigned int) 1856)
+#else
+#define  SIMDDIVIDE_PRIMES  ((unsigned int) 3456)
+#endif
+
+
+/*--------------------------------------
+ * state init from hex forms, accepting the same "t:"/"s:"/"f:" search
+ * prefixes as the standalone tool; the compile-time table size is
+ * applied directly, there is no PRIMES= override when embedded
+ *
+ * returns >0 if successful, <0 otherwise
+ */
+static inline
+int simddivide_init(struct PP_Mod16bit *ps, const char *base,
+                                            const char *incr)
+{
+	int rc = mod16read(ps, base, incr);
+
+	if (rc > 0)
+		set_default_table_size(ps);
+
+	return rc;
+}
+
+
+#if !defined(NO_SIMD_BINARYINIT)
+/*--------------------------------------
+ * state init from little-endian u64 limbs (OpenSSL BIGNUM / GMP
+ * order); see mod16read_le64() for accepted 'primetype's
+ *
+ * returns >0 if successful, <0 otherwise
+ */
+static inline
+int simddivide_init_le64(struct PP_Mod16bit *ps, const uint64_t *limbs,
+                             unsigned int used,    unsigned int primetype)
+{
+	int rc = mod16read_le64(ps, limbs, used, primetype);
+
+	if (rc > 0)
+		set_default_table_size(ps);
+
+	return rc;
+}
+
+
+/*--------------------------------------
+ * state init from raw big-endian bytes; see mod16read_be()
+ *
+ * returns >0 if successful, <0 otherwise
+ */
+static inline
+int simddivide_init_be(struct PP_Mod16bit *ps, const unsigned char *raw,
+                                   size_t rbytes, unsigned int primetype)
+{
+	int rc = mod16read_be(ps, raw, rbytes, primetype);
+
+	if (rc > 0)
+		set_default_table_size(ps);
+
+	return rc;
+}
+#endif   // !NO_SIMD_BINARYINIT
+
+
+/*--------------------------------------
+ * is the current state free of all tabulated prime factors?
+ * nonzero if no small factor has been found; scratch is wiped
+ */
+static inline
+uint16_t simddivide_no_factor(const struct PP_Mod16bit *ps)
+{
+	SIMD_ALIGN uint16_t tmp[ 64 ];
+	SIMD_ALIGN uint16_t tm2[ 64 ];
+	uint16_t rc;
+
+	rc = simd_has_no_factor_w(tmp, tm2, ps);
+
+	wipe(tmp, sizeof(tmp));
+	wipe(tm2, sizeof(tm2));
+
+	return rc;
+}
+
+
+/*--------------------------------------
+ * fill (lsb, count) with the LSB64s of the next 'count' survivors of
+ * the search type selected at init, advancing *ps
+ *
+ * returns the parked LSB64 as the underlying drivers do, 0 on error
+ */
+static inline
+uint64_t simddivide_advance(uint64_t *lsb, unsigned long count,
+                      struct PP_Mod16bit *ps)
+{
+	if (!ps)
+		return 0;
+
+	return search_advance_bytype(lsb, count, ps, ps->mode);
+}
+
+#endif   /* !SF__SIMDDIVIDE */
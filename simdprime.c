@@ -37,6 +37,72 @@
  *                         -- uses initial candidate plus (2*)P*Q increment
  *                         -- with P, Q auxiliary primes
  *    NO_SIMD_PLAINPRIME   -- incremental search checking 6k+1, 6k+5, 6k+7...
+ *    NO_SIMD_WHEEL210     -- plain search stepping a 2*3*5*7 wheel, never
+ *                         -- materializing candidates divisible by 5 or 7
+ *    NO_SIMD_NARROW8      -- packed 8-bit lanes for the first 32 primes,
+ *                         -- front-filtering plain searches at double
+ *                         -- lane density
+ *    NO_SIMD_BATCHINIT    -- division-free table initialization, 16
+ *                         -- primes per group (magic-multiply folds)
+ *    NO_SIMD_WINDOWED     -- two-phase plain search: front-filter whole
+ *                         -- candidate windows, then run rest-table
+ *                         -- groups over the compacted survivor list
+ *    NO_SIMD_BITMAP       -- bitmap survivor output, one bit per 6k+-1
+ *                         -- candidate, for distributed scans
+ *    NO_SIMD_CHECKPOINT   -- mmap-able search-state snapshots, written
+ *                         -- atomically, for checkpoint/resume
+ *    NO_SIMD_BINARYINIT   -- state init directly from binary forms
+ *                         -- (LE u64 limbs, BE bytes), no hex round-trip
+ *    NO_SIMD_PIPELINE     -- double-buffered producer thread: trial
+ *                         -- division overlaps the caller's sink
+ *    NO_SIMD_SOA4         -- four interleaved plain searches, structure
+ *                         -- of arrays, one pass over the prime table
+ *                         -- serving all streams
+ *    NO_SIMD_AUTOTUNE     -- runtime depth cutoff, tuned to the
+ *                         -- measured group cost vs. the downstream
+ *                         -- per-survivor cost
+ *    NO_SIMD_XL32         -- second-tier post-filter with runtime-sieved
+ *                         -- u32 primes above the 16-bit tables, for
+ *                         -- modexp-dominated (safe-prime) searches
+ *    NO_SIMD_DUALSCAN     -- fused twin+safe scan: both companion
+ *                         -- conditions checked against shared products
+ *                         -- in one table pass, two survivor streams
+ *    NO_SIMD_KTUPLE       -- prime k-tuple (constellation) scan: runtime
+ *                         -- companion-offset list, each offset one
+ *                         -- add+compare+OR over shared products
+ *    NO_SIMD_BINWRITER    -- binary survivor records streamed to a file
+ *                         -- from a writer thread; I/O overlaps the
+ *                         -- next scan window (OUTFILE=...)
+ *    NO_SIMD_NUMA         -- hugepage-backed survivor buffers and
+ *                         -- worker pinning, keeping per-stream state
+ *                         -- node-local on multi-socket hosts (PIN=1)
+ *    NO_SIMD_SCRATCHARENA -- deferred-wipe scratch arena: a registered
+ *                         -- long-lived SIMD_Advance replaces per-call
+ *                         -- driver scratch, wiped at session fences
+ *                         -- instead of once per driver invocation
+ *    NO_SIMD_BATCHSCREEN  -- blocked, group-major prescreen of
+ *                         -- externally supplied candidate lists,
+ *                         -- survivor bitmap output (SCREEN=file);
+ *                         -- needs the batch state init
+ *    NO_SIMD_SCANBOUND    -- bounded-result scans: a per-thread
+ *                         -- candidate-check budget stops incremental
+ *                         -- drivers early, for first-hit searches
+ *                         -- (BUDGET=n)
+ *
+ * opt-in build variants:
+ *    SIMD_VLA_KERNELS     -- vector-length-agnostic loop forms of the
+ *                         -- 64-lane group kernels, for predicated VLA
+ *                         -- ISAs (SVE); see Makefile ARMSVE=1
+ *    SIMDPRIME_COUNT_CUSTOM=N
+ *                         -- generate kernels for a nonstandard table
+ *                         -- depth (multiple of 64, below the stock
+ *                         -- table); see Makefile PRIMECOUNT=N
+ *    SIMD_STATS           -- hot-path counters: per-group checked and
+ *                         -- rejected counts, survivor throughput;
+ *                         -- see Makefile STATS=1
+ *    SIMDDIVIDE_EMBED     -- application embedding: compile out main()
+ *                         -- and the standalone drivers, leaving only
+ *                         -- the engines; set by simddivide.h
  *
  * runtime control: set
  *    PRIMES=...            -- nr. of primes to trial-divide against; must
@@ -158,6 +224,36 @@
 #endif
 
 
+//--------------------------------------
+// optional runtime ISA dispatch: clone the driver-level functions per
+// instruction set, selected at startup through the loader's ifunc
+// resolver (CPUID), so one binary carries all SIMD sub-variants
+//
+// since all kernels are force-inlined into the drivers, each clone is
+// autovectorized for its own ISA; see 'MULTI=1' in the makefile
+//
+// intentionally restricted to the driver level: cloning the inline
+// kernels individually would reintroduce per-call dispatch overhead
+//
+#if defined(SIMD_MULTIARCH) && defined(__x86_64__) && defined(__GNUC__)
+#define  SIMD_ISA_CLONES  \
+         __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define  SIMD_ISA_CLONES  /**/
+#endif
+
+
+//--------------------------------------
+// optional-feature entry points: the standalone drivers reference all
+// of them, an embedder (simddivide.h) only the ones it calls
+//
+#if defined(SIMDDIVIDE_EMBED)
+#define  SIMD_OPTIONAL_FN  ATTR_UNUSED__
+#else
+#define  SIMD_OPTIONAL_FN  /**/
+#endif
+
+
 //--------------------------------------
 // placeholder: indicate potentially-sensitive data wiped,
 // not optimized away
@@ -199,6 +295,38 @@ static inline void *wipe(void *s, size_t n)
 #else
 #define  SIMDPRIME_COUNT  ((unsigned int) 576)
 #endif
+
+// generated kernels for a nonstandard prime count; see the _c kernel
+// family and Makefile PRIMECOUNT=...
+//
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+#if (SIMDPRIME_COUNT_CUSTOM % 64) || (SIMDPRIME_COUNT_CUSTOM <= 64)
+#error "SIMDPRIME_COUNT_CUSTOM must be a multiple of 64, above 64"
+#endif
+#if defined(NO_SIMDDIVIDE_L) && defined(NO_SIMDDIVIDE_M)
+#if (SIMDPRIME_COUNT_CUSTOM > 576)
+#error "SIMDPRIME_COUNT_CUSTOM exceeds the compiled-in prime tables"
+#endif
+#elif defined(NO_SIMDDIVIDE_L)
+#if (SIMDPRIME_COUNT_CUSTOM > 1856)
+#error "SIMDPRIME_COUNT_CUSTOM exceeds the compiled-in prime tables"
+#endif
+#else
+#if (SIMDPRIME_COUNT_CUSTOM > 3456)
+#error "SIMDPRIME_COUNT_CUSTOM exceeds the compiled-in prime tables"
+#endif
+#endif
+#if (SIMDPRIME_COUNT_CUSTOM == 576)  || \
+    (SIMDPRIME_COUNT_CUSTOM == 1856) || \
+    (SIMDPRIME_COUNT_CUSTOM == 3456)
+#error "SIMDPRIME_COUNT_CUSTOM is a stock size; use the S/M/L build"
+#endif
+#endif
+
+// primes whose remainders also fit packed 8-bit lanes ([5..139])
+// one 256-bit vector at 32 lanes; see NO_SIMD_NARROW8
+//
+#define  SIMDPRIME_8BIT_COUNT  ((unsigned int) 32)
 // see also report_table_prime_count() and override_table_size(),
 // which must be updated in sync
 //
@@ -245,10 +373,27 @@ struct PP_Mod16bit {
 
 	unsigned int mode;    // search type; see PrimeType_t,
 	                      // SearchType_t and FieldSet_t
+
+#if !defined(NO_SIMD_NARROW8)
+	SIMD_ALIGN
+	uint8_t modn8[ SIMDPRIME_8BIT_COUNT ];
+	                      // packed 8-bit copy of modn[ 0..31 ]
+	                      // ([5..139]); maintained only along the
+	                      // plain/wheel advance paths and jump-ahead,
+	                      // stale during twin/safe searches (which
+	                      // never read it)
+	                      //
+	                      // keep PP_MOD16BIT_INIT0 in sync
+#endif
 } ;
 //
+#if !defined(NO_SIMD_NARROW8)
+#define PP_MOD16BIT_INIT0  \
+        { { 0, }, { 0, }, 0, { 0, }, 0, 0, 0, 0, 0, 0, 0, { 0, }, }
+#else
 #define PP_MOD16BIT_INIT0  \
         { { 0, }, { 0, }, 0, { 0, }, 0, 0, 0, 0, 0, 0, 0, }
+#endif
 
 #define PP_MOD16_INVD_MODE  (~((unsigned int) 0))
 
@@ -280,6 +425,8 @@ typedef enum {
 	SIMD_SEARCHTABLE_S    =  0x100,
 	SIMD_SEARCHTABLE_M    =  0x200,
 	SIMD_SEARCHTABLE_L    =  0x300,
+	SIMD_SEARCHTABLE_C    =  0x400,  // generated, nonstandard count;
+	                                 // see SIMDPRIME_COUNT_CUSTOM
 	SIMD_SEARCHTABLE_MASK = 0xff00
 } SearchType_t ;
 
@@ -300,6 +447,172 @@ static void wipe_advance_struct(struct SIMD_Advance *pa)
 }
 
 
+#if !defined(NO_SIMD_SCRATCHARENA)  //----------------------------------------
+// deferred-wipe scratch arena: daemon-style callers invoking drivers
+// millions of times on small windows register one long-lived
+// SIMD_Advance per thread; drivers then run on the registered struct
+// and skip their per-call scratch wipe, so derived products accumulate
+// only there.  the arena is scrubbed at simd_scratch_flush() fences
+// and at simd_scratch_leave().  without a registration, every driver
+// keeps the stock allocate-use-wipe behavior
+
+static __thread struct SIMD_Advance *simd_scratch_arena;
+static __thread unsigned int simd_scratch_busy;
+                          // arena claimed by an active driver: nested
+                          // drivers fall back to per-call stack scratch
+
+/*--------------------------------------
+ * register 'arena' as this thread's reusable driver scratch; replaces
+ * any previous registration without wiping it, NULL just deregisters
+ *
+ * see simd_scratch_leave() for the wipe-and-deregister form
+ */
+static ATTR_UNUSED__           // embedder-only; see SIMD_OPTIONAL_FN
+void simd_scratch_enter(struct SIMD_Advance *arena)
+{
+	simd_scratch_arena = arena;
+	simd_scratch_busy  = 0;
+}
+
+
+/*--------------------------------------
+ * wipe fence: scrub the registered arena now, keeping it registered
+ */
+static ATTR_UNUSED__           // embedder-only; see SIMD_OPTIONAL_FN
+void simd_scratch_flush(void)
+{
+	wipe_advance_struct(simd_scratch_arena);
+}
+
+
+/*--------------------------------------
+ * session boundary: scrub the registered arena and deregister it
+ */
+static ATTR_UNUSED__           // embedder-only; see SIMD_OPTIONAL_FN
+void simd_scratch_leave(void)
+{
+	wipe_advance_struct(simd_scratch_arena);
+
+	simd_scratch_arena = NULL;
+	simd_scratch_busy  = 0;
+}
+#endif   //-----  !NO_SIMD_SCRATCHARENA  -------------------------------------
+
+
+/*--------------------------------------
+ * driver-entry scratch selection: the thread's registered arena if
+ * available, the caller's stack struct otherwise
+ */
+static inline
+struct SIMD_Advance *advance_scratch(struct SIMD_Advance *local)
+{
+#if !defined(NO_SIMD_SCRATCHARENA)
+	if (simd_scratch_arena && !simd_scratch_busy) {
+		simd_scratch_busy = 1;
+		simd_scratch_arena->wr = 0;
+
+		return simd_scratch_arena;
+	}
+#endif
+
+	return local;
+}
+
+
+/*--------------------------------------
+ * driver-exit counterpart of advance_scratch(): per-call stack
+ * scratch is wiped immediately, arena scratch stays dirty until the
+ * next simd_scratch_flush() or simd_scratch_leave()
+ */
+static inline
+void advance_scratch_done(struct SIMD_Advance *adv,
+                          struct SIMD_Advance *local)
+{
+	if (adv == local) {
+		wipe_advance_struct(local);
+		return;
+	}
+
+#if !defined(NO_SIMD_SCRATCHARENA)
+	simd_scratch_busy = 0;
+#endif
+}
+
+
+#if !defined(NO_SIMD_SCANBOUND)  //-------------------------------------------
+// bounded-result scans: callers arm a per-thread budget of full
+// candidate checks, and the single-stream incremental drivers' outer
+// loops stop early when it runs out, leaving state parked and
+// resumable.  combined with a small 'count' this turns worst-case-
+// sized scans into minimal-latency first-hit searches; see
+// simd_first_hit()
+//
+// granularity is one outer driver iteration (two candidates for the
+// 6k+-1 plain walks, one pair for twin/safe and the fused dual scan,
+// one sequence member or tuple base for the FIPS and k-tuple
+// drivers); the budget saturates at
+// zero and is re-tested at the next iteration, so a scan may overrun
+// by one iteration.  front-filter skip steps are not charged: the
+// budget counts the expensive full-depth checks
+//
+// engines with their own extent semantics (windows, bitmaps, the x4
+// interleave) are bounded by construction and ignore the budget; do
+// not arm one around the batched sink/pipeline engines, which assume
+// every driver call fills its full batch
+
+static __thread uint64_t simd_scan_budget;
+static __thread unsigned int simd_scan_bounded;      // budget armed
+
+/*--------------------------------------
+ * arm this thread's check budget for subsequent driver calls
+ */
+static SIMD_OPTIONAL_FN
+void simd_scan_limit(uint64_t checks)
+{
+	simd_scan_budget  = checks;
+	simd_scan_bounded = 1;
+}
+
+
+/*--------------------------------------
+ * disarm the budget; returns the unspent part, 0 if exhausted (or
+ * never armed)
+ */
+static SIMD_OPTIONAL_FN
+uint64_t simd_scan_limit_clear(void)
+{
+	uint64_t left = simd_scan_bounded ? simd_scan_budget : 0;
+
+	simd_scan_budget  = 0;
+	simd_scan_bounded = 0;
+
+	return left;
+}
+#endif   //-----  !NO_SIMD_SCANBOUND  ----------------------------------------
+
+
+/*--------------------------------------
+ * driver-loop budget charge: false once the armed budget is spent,
+ * always true when none is armed
+ */
+static inline int scan_budget_ok(unsigned int checks)
+{
+#if !defined(NO_SIMD_SCANBOUND)
+	if (simd_scan_bounded) {
+		if (!simd_scan_budget)
+			return 0;
+
+		simd_scan_budget = (simd_scan_budget > checks)
+		                   ? (simd_scan_budget - checks) : 0;
+	}
+#else
+	MARK_UNUSED(checks);
+#endif
+
+	return 1;
+}
+
+
 /*--------------------------------------
  * res[i] = v[i] * coeff[i]
  */
@@ -369,8 +682,7 @@ void simd_advance16x16_inpl(uint16_t v[static 16], uint16_t add)
 }
 
 
-#if 0
-// FIPS 186-x only
+// FIPS 186-x and jump-ahead
 /*--------------------------------------
  * v[] += adv[]
  */
@@ -397,7 +709,6 @@ void simd_advance16x16_inpl_v(uint16_t v[static 16],
 	v[ 14 ] += add[ 14 ];
 	v[ 15 ] += add[ 15 ];
 }
-#endif   // 0: FIPS 186-x only
 
 
 /*--------------------------------------
@@ -534,6 +845,34 @@ void simd_shladd16x16(uint16_t r[static 16], const uint16_t v[static 16],
 }
 
 
+/*--------------------------------------
+ * r[] = v[] + add[]
+ */
+static inline
+REALLY_FORCE_INLINE
+//
+void simd_add16x16(uint16_t r[static 16], const uint16_t v[static 16],
+                                        const uint16_t add[static 16])
+{
+	r[  0 ] = v[  0 ] + add[  0 ];
+	r[  1 ] = v[  1 ] + add[  1 ];
+	r[  2 ] = v[  2 ] + add[  2 ];
+	r[  3 ] = v[  3 ] + add[  3 ];
+	r[  4 ] = v[  4 ] + add[  4 ];
+	r[  5 ] = v[  5 ] + add[  5 ];
+	r[  6 ] = v[  6 ] + add[  6 ];
+	r[  7 ] = v[  7 ] + add[  7 ];
+	r[  8 ] = v[  8 ] + add[  8 ];
+	r[  9 ] = v[  9 ] + add[  9 ];
+	r[ 10 ] = v[ 10 ] + add[ 10 ];
+	r[ 11 ] = v[ 11 ] + add[ 11 ];
+	r[ 12 ] = v[ 12 ] + add[ 12 ];
+	r[ 13 ] = v[ 13 ] + add[ 13 ];
+	r[ 14 ] = v[ 14 ] + add[ 14 ];
+	r[ 15 ] = v[ 15 ] + add[ 15 ];
+}
+
+
 /*--------------------------------------
  * r[] = min(a[], b[])
  * expect repeated expressions to be recognized and min() substituted
@@ -591,6 +930,35 @@ void simd_lemask16x16_inpl(uint16_t r[static 16],
 }
 
 
+/*--------------------------------------
+ * non-destructive form of simd_lemask16x16_inpl(): r[] gets all-1
+ * where v[] <= limit[]; 0 otherwise.  keeps v[] for further offsets
+ */
+static inline
+REALLY_FORCE_INLINE
+//
+void simd_lemask16x16(uint16_t r[static 16], const uint16_t v[static 16],
+                                         const uint16_t limit[static 16])
+{
+	r[  0 ] = le16mask(v[  0 ], limit[  0 ]);
+	r[  1 ] = le16mask(v[  1 ], limit[  1 ]);
+	r[  2 ] = le16mask(v[  2 ], limit[  2 ]);
+	r[  3 ] = le16mask(v[  3 ], limit[  3 ]);
+	r[  4 ] = le16mask(v[  4 ], limit[  4 ]);
+	r[  5 ] = le16mask(v[  5 ], limit[  5 ]);
+	r[  6 ] = le16mask(v[  6 ], limit[  6 ]);
+	r[  7 ] = le16mask(v[  7 ], limit[  7 ]);
+	r[  8 ] = le16mask(v[  8 ], limit[  8 ]);
+	r[  9 ] = le16mask(v[  9 ], limit[  9 ]);
+	r[ 10 ] = le16mask(v[ 10 ], limit[ 10 ]);
+	r[ 11 ] = le16mask(v[ 11 ], limit[ 11 ]);
+	r[ 12 ] = le16mask(v[ 12 ], limit[ 12 ]);
+	r[ 13 ] = le16mask(v[ 13 ], limit[ 13 ]);
+	r[ 14 ] = le16mask(v[ 14 ], limit[ 14 ]);
+	r[ 15 ] = le16mask(v[ 15 ], limit[ 15 ]);
+}
+
+
 /*--------------------------------------
  * safe-prime comparison: with v[] storing x * mod small-primes[],
  * report if any of the P|x or P|2x+1: r[] will be all-00 if no factor
@@ -721,6 +1089,50 @@ unsigned int simd_is_all0x64x16_inpl(uint16_t v[static 64],
 }
 
 
+#if defined(SIMD_VLA_KERNELS)  //-----  width-oblivious 64-lane groups  -------
+// vector-length-agnostic forms of the 64-lane group kernels: plain
+// counted loops over whole groups instead of the fixed 16-lane unrolled
+// slices, so predicated VLA ISAs (SVE et al.) fill whatever vector
+// length the core has -- one binary covers 128..2048-bit datapaths
+//
+// the scalar per-lane helpers (le16mask(), m2range_1unit()) are shared
+// with the unrolled forms; only the group iteration differs
+
+/*-----------------------------------------
+ * v[] += adv; preserving mod-prime by subtracting m2r[] if applicable
+ */
+static inline
+REALLY_FORCE_INLINE
+/**/
+void simd_advance64x16_m2r_inpl(uint16_t v[static 64], uint16_t adv,
+                        const uint16_t m2r[static 64])
+{
+	unsigned int i;
+
+	for (i=0; i<64; ++i)
+		v[i] = m2range_1unit((uint16_t) (v[i] + adv), m2r[i]);
+}
+
+
+// FIPS 186-x and jump-ahead
+/*---------------------------------------
+ * v[] += adv[]; preserving mod-prime by subtracting m2r[] if applicable
+ * 64 elements
+ */
+static inline
+REALLY_FORCE_INLINE
+/**/
+void simd_advance64x16_m2r_inpl_v(uint16_t v[static 64],
+                          const uint16_t adv[static 64],
+                          const uint16_t m2r[static 64])
+{
+	unsigned int i;
+
+	for (i=0; i<64; ++i)
+		v[i] = m2range_1unit((uint16_t) (v[i] + adv[i]), m2r[i]);
+}
+
+#else   //-----  fixed 16-lane unrolled groups  -------------------------------
 /*-----------------------------------------
  * v[] += adv; preserving mod-prime by subtracting m2r[] if applicable
  */
@@ -744,7 +1156,7 @@ void simd_advance64x16_m2r_inpl(uint16_t v[static 64], uint16_t adv,
 }
 
 
-#if 0    // FIPS 186-x only
+// FIPS 186-x and jump-ahead
 /*---------------------------------------
  * v[] += adv[]; preserving mod-prime by subtracting m2r[] if applicable
  * 64 elements
@@ -768,83 +1180,485 @@ void simd_advance64x16_m2r_inpl_v(uint16_t v[static 64],
 	simd_advance16x16_inpl_v(&(v[ 48 ]), &(adv[ 48 ]));
 	simd_m2range16x16_inpl  (&(v[ 48 ]), &(m2r[ 48 ]));
 }
-#endif      // 0: FIPS 186-x
+#endif  //-----  /SIMD_VLA_KERNELS  -------------------------------------------
 
 
-/*-----------------------------------------
- * 'plain' prime search: can modn[] indicate a prime?
- *
- * SECURITY NOTE: tmp[] and tmp2[] are scratch, filled with (potentially)secret
- * state-dependent data, and SHOULD be wiped upon return.
+#if !defined(NO_SIMD_NARROW8)  //-----  packed 8-bit lanes  ------------------
+// uint8_t copies of the first 32 remainders ([5..139]; all primes,
+// inverses and limits fit 8 bits): 32 lanes per 256-bit vector instead
+// of 16, as a front filter where most of the rejection probability
+// lives
+//
+// the conditional reduction works as for the 16-bit lanes, with the
+// at-rest threshold at 0xc0 instead of 0x8000: mod2range entries are
+// >= 0x40, so one reduction restores the range for advances up to 0x3f
+// (per-candidate advances are <= 10; see wheel210_step())
+
+/*--------------------------------------
+ * 8-bit le16mask() equivalent
  */
-static inline
-REALLY_FORCE_INLINE
-/**/
-uint16_t simd_nofactor64x16(uint16_t tmp[static 64],
-                           uint16_t tmp2[static 64],
-                     const uint16_t modn[static 64],
-                      const uint16_t inv[static 64],
-                    const uint16_t limit[static 64])
+static inline uint8_t le8mask(uint8_t a, uint8_t b)
 {
-					// compute n * 1/prime  mod 2^16
+	return (a <= b) ? ~((uint8_t) 0) : 0;
+}
 
-	simd_mul16x16(  tmp,          modn,          inv       );
-	simd_mul16x16(&(tmp[ 16 ]), &(modn[ 16 ]), &(inv[ 16 ]));
-	simd_mul16x16(&(tmp[ 32 ]), &(modn[ 32 ]), &(inv[ 32 ]));
-	simd_mul16x16(&(tmp[ 48 ]), &(modn[ 48 ]), &(inv[ 48 ]));
 
-					// any of the products <= limit[ ]?
-					// divides -> ffff; not -> 0
+/*--------------------------------------
+ * 8-bit add_if_ge(); see there for the Boolean-mask construction
+ */
+static inline uint8_t add_if_ge8(uint8_t val, uint8_t limit, uint8_t add)
+{
+	return val + (((uint8_t) -((int8_t) (limit <= val))) & add);
+}
 
-	simd_lemask16x16_inpl(  tmp,          limit       );
-	simd_lemask16x16_inpl(&(tmp[ 16 ]), &(limit[ 16 ]));
-	simd_lemask16x16_inpl(&(tmp[ 32 ]), &(limit[ 32 ]));
-	simd_lemask16x16_inpl(&(tmp[ 48 ]), &(limit[ 48 ]));
 
-	return simd_is_all0x64x16_inpl(tmp, tmp2);
+/*--------------------------------------
+ * res[] = v[] * coeff[]  mod 2^8
+ */
+static inline
+REALLY_FORCE_INLINE
+//
+void simd_mul8x32(uint8_t res[static 32], const uint8_t v[static 32],
+          const uint8_t coeff[static 32])
+{
+	res[  0 ] = v[  0 ] * coeff[  0 ];
+	res[  1 ] = v[  1 ] * coeff[  1 ];
+	res[  2 ] = v[  2 ] * coeff[  2 ];
+	res[  3 ] = v[  3 ] * coeff[  3 ];
+	res[  4 ] = v[  4 ] * coeff[  4 ];
+	res[  5 ] = v[  5 ] * coeff[  5 ];
+	res[  6 ] = v[  6 ] * coeff[  6 ];
+	res[  7 ] = v[  7 ] * coeff[  7 ];
+	res[  8 ] = v[  8 ] * coeff[  8 ];
+	res[  9 ] = v[  9 ] * coeff[  9 ];
+	res[ 10 ] = v[ 10 ] * coeff[ 10 ];
+	res[ 11 ] = v[ 11 ] * coeff[ 11 ];
+	res[ 12 ] = v[ 12 ] * coeff[ 12 ];
+	res[ 13 ] = v[ 13 ] * coeff[ 13 ];
+	res[ 14 ] = v[ 14 ] * coeff[ 14 ];
+	res[ 15 ] = v[ 15 ] * coeff[ 15 ];
+	res[ 16 ] = v[ 16 ] * coeff[ 16 ];
+	res[ 17 ] = v[ 17 ] * coeff[ 17 ];
+	res[ 18 ] = v[ 18 ] * coeff[ 18 ];
+	res[ 19 ] = v[ 19 ] * coeff[ 19 ];
+	res[ 20 ] = v[ 20 ] * coeff[ 20 ];
+	res[ 21 ] = v[ 21 ] * coeff[ 21 ];
+	res[ 22 ] = v[ 22 ] * coeff[ 22 ];
+	res[ 23 ] = v[ 23 ] * coeff[ 23 ];
+	res[ 24 ] = v[ 24 ] * coeff[ 24 ];
+	res[ 25 ] = v[ 25 ] * coeff[ 25 ];
+	res[ 26 ] = v[ 26 ] * coeff[ 26 ];
+	res[ 27 ] = v[ 27 ] * coeff[ 27 ];
+	res[ 28 ] = v[ 28 ] * coeff[ 28 ];
+	res[ 29 ] = v[ 29 ] * coeff[ 29 ];
+	res[ 30 ] = v[ 30 ] * coeff[ 30 ];
+	res[ 31 ] = v[ 31 ] * coeff[ 31 ];
 }
 
 
 /*--------------------------------------
- * does the first set of prime moduli (64 primes) indicate prime?
- *
- * SECURITY NOTE: tmp[] and tmp2[] are scratch areas, which caller
- * MUST maintain and wipe
+ * replace lanes with all-1 where r[] <= limit[]; 0 otherwise
  */
 static inline
 REALLY_FORCE_INLINE
-/**/
-uint16_t simd_nofactor_first(uint16_t tmp[static 64],
-                             uint16_t tm2[static 64],
-             const struct PP_Mod16bit *ps)
+//
+void simd_lemask8x32_inpl(uint8_t r[static 32],
+                const uint8_t limit[static 32])
 {
-	return simd_nofactor64x16(tmp, tm2, ps->modn,
-	                          firstprimes_inverse_simd,
-	                          firstprimes_mullimit_simd);
+	r[  0 ] = le8mask(r[  0 ], limit[  0 ]);
+	r[  1 ] = le8mask(r[  1 ], limit[  1 ]);
+	r[  2 ] = le8mask(r[  2 ], limit[  2 ]);
+	r[  3 ] = le8mask(r[  3 ], limit[  3 ]);
+	r[  4 ] = le8mask(r[  4 ], limit[  4 ]);
+	r[  5 ] = le8mask(r[  5 ], limit[  5 ]);
+	r[  6 ] = le8mask(r[  6 ], limit[  6 ]);
+	r[  7 ] = le8mask(r[  7 ], limit[  7 ]);
+	r[  8 ] = le8mask(r[  8 ], limit[  8 ]);
+	r[  9 ] = le8mask(r[  9 ], limit[  9 ]);
+	r[ 10 ] = le8mask(r[ 10 ], limit[ 10 ]);
+	r[ 11 ] = le8mask(r[ 11 ], limit[ 11 ]);
+	r[ 12 ] = le8mask(r[ 12 ], limit[ 12 ]);
+	r[ 13 ] = le8mask(r[ 13 ], limit[ 13 ]);
+	r[ 14 ] = le8mask(r[ 14 ], limit[ 14 ]);
+	r[ 15 ] = le8mask(r[ 15 ], limit[ 15 ]);
+	r[ 16 ] = le8mask(r[ 16 ], limit[ 16 ]);
+	r[ 17 ] = le8mask(r[ 17 ], limit[ 17 ]);
+	r[ 18 ] = le8mask(r[ 18 ], limit[ 18 ]);
+	r[ 19 ] = le8mask(r[ 19 ], limit[ 19 ]);
+	r[ 20 ] = le8mask(r[ 20 ], limit[ 20 ]);
+	r[ 21 ] = le8mask(r[ 21 ], limit[ 21 ]);
+	r[ 22 ] = le8mask(r[ 22 ], limit[ 22 ]);
+	r[ 23 ] = le8mask(r[ 23 ], limit[ 23 ]);
+	r[ 24 ] = le8mask(r[ 24 ], limit[ 24 ]);
+	r[ 25 ] = le8mask(r[ 25 ], limit[ 25 ]);
+	r[ 26 ] = le8mask(r[ 26 ], limit[ 26 ]);
+	r[ 27 ] = le8mask(r[ 27 ], limit[ 27 ]);
+	r[ 28 ] = le8mask(r[ 28 ], limit[ 28 ]);
+	r[ 29 ] = le8mask(r[ 29 ], limit[ 29 ]);
+	r[ 30 ] = le8mask(r[ 30 ], limit[ 30 ]);
+	r[ 31 ] = le8mask(r[ 31 ], limit[ 31 ]);
 }
 
 
 /*--------------------------------------
- * does the 'not first' set of prime moduli indicate a possible prime?
- * checks up to the first 576 suitable primes
- *
- * SECURITY NOTE: tmp[] and tmp2[] are scratch areas, which caller
- * MUST maintain and wipe
+ * v[] += (vector of) adv x 32
  */
 static inline
 REALLY_FORCE_INLINE
-/**/
-uint16_t simd_nofactor_rest_s(uint16_t tmp[static 64],
-                              uint16_t tm2[static 64],
-              const struct PP_Mod16bit *ps)
+//
+void simd_advance8x32_inpl(uint8_t v[static 32], uint8_t add)
 {
-	return (simd_nofactor64x16(tmp, tm2, &(ps->modn[  64 ]),
-	                     &(firstprimes_inverse_simd[  64 ]),
-	                    &(firstprimes_mullimit_simd[  64 ])) &&
+	v[  0 ] += add;
+	v[  1 ] += add;
+	v[  2 ] += add;
+	v[  3 ] += add;
+	v[  4 ] += add;
+	v[  5 ] += add;
+	v[  6 ] += add;
+	v[  7 ] += add;
+	v[  8 ] += add;
+	v[  9 ] += add;
+	v[ 10 ] += add;
+	v[ 11 ] += add;
+	v[ 12 ] += add;
+	v[ 13 ] += add;
+	v[ 14 ] += add;
+	v[ 15 ] += add;
+	v[ 16 ] += add;
+	v[ 17 ] += add;
+	v[ 18 ] += add;
+	v[ 19 ] += add;
+	v[ 20 ] += add;
+	v[ 21 ] += add;
+	v[ 22 ] += add;
+	v[ 23 ] += add;
+	v[ 24 ] += add;
+	v[ 25 ] += add;
+	v[ 26 ] += add;
+	v[ 27 ] += add;
+	v[ 28 ] += add;
+	v[ 29 ] += add;
+	v[ 30 ] += add;
+	v[ 31 ] += add;
+}
 
-	        simd_nofactor64x16(tmp, tm2, &(ps->modn[ 128 ]),
-	                     &(firstprimes_inverse_simd[ 128 ]),
-	                    &(firstprimes_mullimit_simd[ 128 ])) &&
+
+/*--------------------------------------
+ * 8-bit m2range_1unit(): reduce if value is >= 0xc0
+ */
+static inline uint8_t m2range8_1unit(uint8_t val, uint8_t m2r)
+{
+	return add_if_ge8(val, UINT8_C(0xc0), m2r);
+}
+
+
+/*--------------------------------------
+ * conditionally reduce v[] where value is >= 0xc0; see
+ * simd_m2range16x16_inpl()
+ */
+static inline
+REALLY_FORCE_INLINE
+//
+void simd_m2range8x32_inpl(uint8_t v[static 32],
+                   const uint8_t m2r[static 32])
+{
+	v[  0 ] = m2range8_1unit(v[  0 ], m2r[  0 ]);
+	v[  1 ] = m2range8_1unit(v[  1 ], m2r[  1 ]);
+	v[  2 ] = m2range8_1unit(v[  2 ], m2r[  2 ]);
+	v[  3 ] = m2range8_1unit(v[  3 ], m2r[  3 ]);
+	v[  4 ] = m2range8_1unit(v[  4 ], m2r[  4 ]);
+	v[  5 ] = m2range8_1unit(v[  5 ], m2r[  5 ]);
+	v[  6 ] = m2range8_1unit(v[  6 ], m2r[  6 ]);
+	v[  7 ] = m2range8_1unit(v[  7 ], m2r[  7 ]);
+	v[  8 ] = m2range8_1unit(v[  8 ], m2r[  8 ]);
+	v[  9 ] = m2range8_1unit(v[  9 ], m2r[  9 ]);
+	v[ 10 ] = m2range8_1unit(v[ 10 ], m2r[ 10 ]);
+	v[ 11 ] = m2range8_1unit(v[ 11 ], m2r[ 11 ]);
+	v[ 12 ] = m2range8_1unit(v[ 12 ], m2r[ 12 ]);
+	v[ 13 ] = m2range8_1unit(v[ 13 ], m2r[ 13 ]);
+	v[ 14 ] = m2range8_1unit(v[ 14 ], m2r[ 14 ]);
+	v[ 15 ] = m2range8_1unit(v[ 15 ], m2r[ 15 ]);
+	v[ 16 ] = m2range8_1unit(v[ 16 ], m2r[ 16 ]);
+	v[ 17 ] = m2range8_1unit(v[ 17 ], m2r[ 17 ]);
+	v[ 18 ] = m2range8_1unit(v[ 18 ], m2r[ 18 ]);
+	v[ 19 ] = m2range8_1unit(v[ 19 ], m2r[ 19 ]);
+	v[ 20 ] = m2range8_1unit(v[ 20 ], m2r[ 20 ]);
+	v[ 21 ] = m2range8_1unit(v[ 21 ], m2r[ 21 ]);
+	v[ 22 ] = m2range8_1unit(v[ 22 ], m2r[ 22 ]);
+	v[ 23 ] = m2range8_1unit(v[ 23 ], m2r[ 23 ]);
+	v[ 24 ] = m2range8_1unit(v[ 24 ], m2r[ 24 ]);
+	v[ 25 ] = m2range8_1unit(v[ 25 ], m2r[ 25 ]);
+	v[ 26 ] = m2range8_1unit(v[ 26 ], m2r[ 26 ]);
+	v[ 27 ] = m2range8_1unit(v[ 27 ], m2r[ 27 ]);
+	v[ 28 ] = m2range8_1unit(v[ 28 ], m2r[ 28 ]);
+	v[ 29 ] = m2range8_1unit(v[ 29 ], m2r[ 29 ]);
+	v[ 30 ] = m2range8_1unit(v[ 30 ], m2r[ 30 ]);
+	v[ 31 ] = m2range8_1unit(v[ 31 ], m2r[ 31 ]);
+}
+
+
+/*--------------------------------------
+ * is the 32x8 lane array all zeroes?  (same 256 bits as
+ * simd_is_all0(); see the VPTEST notes there)
+ */
+static inline
+REALLY_FORCE_INLINE
+//
+unsigned int simd_is_all0_8x32(const uint8_t v[static 32])
+{
+	return !memcmp(simd_allzero256bits, v, 32);
+}
+
+
+/*--------------------------------------
+ * advance the packed 8-bit lanes; one vector add plus one reduction
+ *
+ * 'adv' MUST stay below 0x40, or a single reduction no longer
+ * restores the < 0xc0 at-rest range (per-candidate advances max
+ * out at 10)
+ */
+static inline
+REALLY_FORCE_INLINE
+//
+void simd_advance_narrow8(struct PP_Mod16bit *ps, uint8_t adv)
+{
+	simd_advance8x32_inpl(ps->modn8, adv);
+	simd_m2range8x32_inpl(ps->modn8, firstprimes8_mod2range_simd);
+}
+
+
+/*--------------------------------------
+ * (re)derive the packed 8-bit lanes from the 16-bit remainders
+ * cold path only (state init and jump-ahead)
+ */
+static void simd_narrow8_refresh(struct PP_Mod16bit *ps)
+{
+	unsigned int i;
+
+	for (i=0; i<SIMDPRIME_8BIT_COUNT; ++i)
+		ps->modn8[i] = (uint8_t) (ps->modn[i] % firstprimes[i]);
+}
+
+
+/*--------------------------------------
+ * front filter: small factor among the first 32 primes?
+ * nonzero if none of [5..139] divides; one vector's worth of work
+ * for most of the rejection probability
+ *
+ * SECURITY NOTE: tmp[] is scratch which caller MUST maintain and wipe
+ */
+static inline
+REALLY_FORCE_INLINE
+/**/
+uint16_t simd_nofactor8_first(uint8_t tmp[static 32],
+              const struct PP_Mod16bit *ps)
+{
+	simd_mul8x32(tmp, ps->modn8, firstprimes8_inverse_simd);
+
+	simd_lemask8x32_inpl(tmp, firstprimes8_mullimit_simd);
+
+	return simd_is_all0_8x32(tmp);
+}
+#endif   //-----  !NO_SIMD_NARROW8  ------------------------------------------
+
+
+/*-----------------------------------------
+ * 'plain' prime search: can modn[] indicate a prime?
+ *
+ * SECURITY NOTE: tmp[] and tmp2[] are scratch, filled with (potentially)secret
+ * state-dependent data, and SHOULD be wiped upon return.
+ */
+#if defined(SIMD_VLA_KERNELS)  //-----  width-oblivious loop form  ------------
+static inline
+REALLY_FORCE_INLINE
+/**/
+uint16_t simd_nofactor64x16(uint16_t tmp[static 64],
+                           uint16_t tmp2[static 64],
+                     const uint16_t modn[static 64],
+                      const uint16_t inv[static 64],
+                    const uint16_t limit[static 64])
+{
+	uint16_t any = 0;
+	unsigned int i;
+
+	(void) tmp2;                     // scratch of the unrolled form
+
+					// n * 1/prime mod 2^16 <= limit[]?
+					// divides -> ffff; not -> 0
+
+	for (i=0; i<64; ++i)
+		tmp[i] = le16mask((uint16_t) (modn[i] * inv[i]), limit[i]);
+
+	for (i=0; i<64; ++i)             // OR-reduce; VLA ISAs carry this
+		any |= tmp[i];           // as a predicated reduction
+
+	return !any;
+}
+
+#else   //-----  fixed 16-lane unrolled groups  -------------------------------
+static inline
+REALLY_FORCE_INLINE
+/**/
+uint16_t simd_nofactor64x16(uint16_t tmp[static 64],
+                           uint16_t tmp2[static 64],
+                     const uint16_t modn[static 64],
+                      const uint16_t inv[static 64],
+                    const uint16_t limit[static 64])
+{
+					// compute n * 1/prime  mod 2^16
+
+	simd_mul16x16(  tmp,          modn,          inv       );
+	simd_mul16x16(&(tmp[ 16 ]), &(modn[ 16 ]), &(inv[ 16 ]));
+	simd_mul16x16(&(tmp[ 32 ]), &(modn[ 32 ]), &(inv[ 32 ]));
+	simd_mul16x16(&(tmp[ 48 ]), &(modn[ 48 ]), &(inv[ 48 ]));
+
+					// any of the products <= limit[ ]?
+					// divides -> ffff; not -> 0
+
+	simd_lemask16x16_inpl(  tmp,          limit       );
+	simd_lemask16x16_inpl(&(tmp[ 16 ]), &(limit[ 16 ]));
+	simd_lemask16x16_inpl(&(tmp[ 32 ]), &(limit[ 32 ]));
+	simd_lemask16x16_inpl(&(tmp[ 48 ]), &(limit[ 48 ]));
+
+	return simd_is_all0x64x16_inpl(tmp, tmp2);
+}
+#endif  //-----  /SIMD_VLA_KERNELS  -------------------------------------------
+
+
+#if defined(SIMD_STATS)  //-----  hot-path counters  --------------------------
+// optional rejection statistics: which 64-lane groups actually earn
+// their keep on the caller's candidate distribution (FIPS 186
+// increments are not uniform odd numbers, so the offline table is only
+// a first approximation)
+//
+// counting shims wrap the group kernels; the group index is recovered
+// from the inverse-table offset, so every caller -- front checks,
+// unrolled rest chains, runtime-bounded loops -- feeds the same
+// histogram.  rejected[g] is the early-exit depth distribution;
+// checked[g] shows how many candidates reach each group at all
+//
+// counters are plain u64, not atomic: totals under multi-threaded
+// searches are approximate.  the 8-bit narrow front filter is not
+// counted
+
+#include <inttypes.h>
+#include <time.h>
+
+struct SIMD_Stats {
+	uint64_t checked [ SIMDPRIME_COUNT /64 ];     // candidates reaching
+	uint64_t rejected[ SIMDPRIME_COUNT /64 ];     // ...rejected by group
+
+	uint64_t survivors;              // report_current_lsb() registrations
+
+	struct timespec start;           // last simd_stats_reset()
+} ;
+static struct SIMD_Stats simd_stats;
+
+
+//--------------------------------------
+static inline void simd_stats_reset(void)
+{
+	memset(&simd_stats, 0, sizeof(simd_stats));
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &(simd_stats.start));
+}
+
+
+/*--------------------------------------
+ * per-group checked/rejected counts, plus survivor throughput since
+ * the last reset; groups never reached are skipped
+ */
+static inline void simd_stats_report(void)
+{
+	struct timespec now;
+	unsigned int g;
+	float ms;
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+	ms = cu_msdelta2(&(simd_stats.start), &now);
+
+	printf("## STATS.SURVIVORS=%" PRIu64 "\n", simd_stats.survivors);
+
+	if (ms > 0) {
+		printf("## STATS.SURV_PER_SEC=%.1f\n",
+		       ((float) simd_stats.survivors) * 1000 / ms);
+	}
+
+	for (g=0; g<ARRAY_ELEMS(simd_stats.checked); ++g) {
+		if (!simd_stats.checked[g])
+			continue;
+
+		printf("## STATS.GROUP[%u]=%" PRIu64 ",%" PRIu64 ",%.4f%%\n",
+		       g, simd_stats.checked[g], simd_stats.rejected[g],
+		       100.0 * ((double) simd_stats.rejected[g]) /
+		               ((double) simd_stats.checked [g]));
+	}
+}
+
+
+//--------------------------------------
+static inline
+uint16_t simd_stats_nofactor64x16(uint16_t tmp[static 64],
+                                 uint16_t tmp2[static 64],
+                           const uint16_t modn[static 64],
+                            const uint16_t inv[static 64],
+                          const uint16_t limit[static 64])
+{
+	uint16_t rc = simd_nofactor64x16(tmp, tmp2, modn, inv, limit);
+	size_t g = ((size_t) (inv - firstprimes_inverse_simd)) /64;
+
+	++simd_stats.checked[g];
+	if (!rc)
+		++simd_stats.rejected[g];
+
+	return rc;
+}
+//
+#define simd_nofactor64x16(tmp, tm2, modn, inv, limit)  \
+        simd_stats_nofactor64x16((tmp), (tm2), (modn), (inv), (limit))
+#endif   //-----  SIMD_STATS  -------------------------------------------------
+
+
+/*--------------------------------------
+ * does the first set of prime moduli (64 primes) indicate prime?
+ *
+ * SECURITY NOTE: tmp[] and tmp2[] are scratch areas, which caller
+ * MUST maintain and wipe
+ */
+static inline
+REALLY_FORCE_INLINE
+/**/
+uint16_t simd_nofactor_first(uint16_t tmp[static 64],
+                             uint16_t tm2[static 64],
+             const struct PP_Mod16bit *ps)
+{
+	return simd_nofactor64x16(tmp, tm2, ps->modn,
+	                          firstprimes_inverse_simd,
+	                          firstprimes_mullimit_simd);
+}
+
+
+/*--------------------------------------
+ * does the 'not first' set of prime moduli indicate a possible prime?
+ * checks up to the first 576 suitable primes
+ *
+ * SECURITY NOTE: tmp[] and tmp2[] are scratch areas, which caller
+ * MUST maintain and wipe
+ */
+static inline
+REALLY_FORCE_INLINE
+/**/
+uint16_t simd_nofactor_rest_s(uint16_t tmp[static 64],
+                              uint16_t tm2[static 64],
+              const struct PP_Mod16bit *ps)
+{
+	return (simd_nofactor64x16(tmp, tm2, &(ps->modn[  64 ]),
+	                     &(firstprimes_inverse_simd[  64 ]),
+	                    &(firstprimes_mullimit_simd[  64 ])) &&
+
+	        simd_nofactor64x16(tmp, tm2, &(ps->modn[ 128 ]),
+	                     &(firstprimes_inverse_simd[ 128 ]),
+	                    &(firstprimes_mullimit_simd[ 128 ])) &&
 
 	        simd_nofactor64x16(tmp, tm2, &(ps->modn[ 192 ]),
 	                     &(firstprimes_inverse_simd[ 192 ]),
@@ -1079,6 +1893,33 @@ uint16_t simd_nofactor_rest_l(uint16_t tmp[static 64],
 }
 
 
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+/*--------------------------------------
+ * generated-size version of simd_nofactor_rest_s(): checks primes
+ * [64, SIMDPRIME_COUNT_CUSTOM) in a compile-time bounded loop, which
+ * unrolls to the same group kernels as the hand-cloned S/M/L chains
+ */
+static inline
+REALLY_FORCE_INLINE
+/**/
+uint16_t simd_nofactor_rest_c(uint16_t tmp[static 64],
+                              uint16_t tm2[static 64],
+              const struct PP_Mod16bit *ps)
+{
+	unsigned int g;
+
+	for (g=64; g<SIMDPRIME_COUNT_CUSTOM; g+=64) {
+		if (!simd_nofactor64x16(tmp, tm2, &(ps->modn[ g ]),
+		                  &(firstprimes_inverse_simd[ g ]),
+		                 &(firstprimes_mullimit_simd[ g ])))
+			return 0;
+	}
+
+	return 1;
+}
+#endif   // SIMDPRIME_COUNT_CUSTOM  ------------------------------------------
+
+
 /*--------------------------------------
  * does the current modn[] indicate a small factor among the 64 small
  * primes in the corresponding firstprimes[]?
@@ -1095,6 +1936,32 @@ uint16_t simd_no_spfactor64x16(uint16_t tmp[static 64],
                        const uint16_t limit[static 64]) ;
 
 
+#if defined(SIMD_STATS)
+//--------------------------------------
+// counting shim; see simd_stats_nofactor64x16()
+//
+static inline
+uint16_t simd_stats_no_spfactor64x16(uint16_t tmp[static 64],
+                                    uint16_t tmp2[static 64],
+                              const uint16_t modn[static 64],
+                               const uint16_t inv[static 64],
+                             const uint16_t limit[static 64])
+{
+	uint16_t rc = simd_no_spfactor64x16(tmp, tmp2, modn, inv, limit);
+	size_t g = ((size_t) (inv - firstprimes_inverse_simd)) /64;
+
+	++simd_stats.checked[g];
+	if (!rc)
+		++simd_stats.rejected[g];
+
+	return rc;
+}
+//
+#define simd_no_spfactor64x16(tmp, tm2, modn, inv, limit)  \
+        simd_stats_no_spfactor64x16((tmp), (tm2), (modn), (inv), (limit))
+#endif   // SIMD_STATS
+
+
 #if 0
 /*--------------------------------------
  * does the 'first' set of prime moduli indicate a possible safe prime?
@@ -1373,6 +2240,32 @@ uint16_t simd_no_spfactor_rest_l(uint16_t tmp[static   64],
 }
 
 
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+/*--------------------------------------
+ * generated-size version of simd_no_spfactor_rest1(): checks primes
+ * [64, SIMDPRIME_COUNT_CUSTOM) in a compile-time bounded loop
+ */
+static inline
+REALLY_FORCE_INLINE
+/**/
+uint16_t simd_no_spfactor_rest_c(uint16_t tmp[static   64],
+                                uint16_t tmp2[static   64],
+                          const uint16_t modn[static SIMDPRIME_COUNT_CUSTOM])
+{
+	unsigned int g;
+
+	for (g=64; g<SIMDPRIME_COUNT_CUSTOM; g+=64) {
+		if (!simd_no_spfactor64x16(tmp, tmp2, &(modn[ g ]),
+		                &(firstprimes_inverse_simd[ g ]),
+		               &(firstprimes_mullimit_simd[ g ])))
+			return 0;
+	}
+
+	return 1;
+}
+#endif   // SIMDPRIME_COUNT_CUSTOM  ------------------------------------------
+
+
 #if 0
 /*--------------------------------------
  * does any of the 'rest' of primes indicate a factor
@@ -1604,7 +2497,26 @@ void simd_advance_remainders_rest_l(struct PP_Mod16bit *dst, uint16_t adv)
 }
 
 
-#if 0     // FIPS 186-x only
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+/*--------------------------------------
+ * generated-size equivalent of simd_advance_remainders_rest()
+ */
+static inline
+REALLY_FORCE_INLINE
+/**/
+void simd_advance_remainders_rest_c(struct PP_Mod16bit *dst, uint16_t adv)
+{
+	unsigned int g;
+
+	for (g=64; g<SIMDPRIME_COUNT_CUSTOM; g+=64) {
+		simd_advance64x16_m2r_inpl(&(dst->modn[ g ]), adv,
+		          &(firstprimes_mod2range_simd[ g ]));
+	}
+}
+#endif   // SIMDPRIME_COUNT_CUSTOM  ------------------------------------------
+
+
+#if !defined(NO_SIMD_FIPS186PRIME)     // FIPS 186-x only
 /*--------------------------------------
  * advance rest of state, which was skipped by first-rounds' checking
  * small table part
@@ -1652,8 +2564,8 @@ void simd_advance_rest_v_s(struct PP_Mod16bit *dst,
 #endif   // 0: FIPS 186-x
 
 
-#if !defined(NO_SIMDDIVIDE_M) && !defined(NO_SIMDDIVIDE_L)  //---------------
-#if 0   // FIPS 186-x only
+#if !defined(NO_SIMDDIVIDE_M)  //---------------------------------------------
+#if !defined(NO_SIMD_FIPS186PRIME)   // FIPS 186-x only
 /*--------------------------------------
  * mid-sized equivalent of simd_advance_rest_v_s()
  */
@@ -1746,10 +2658,10 @@ void simd_advance_rest_v_m(struct PP_Mod16bit *dst,
 	            &(firstprimes_mod2range_simd[ 1792 ]));
 }
 #endif  // 0: FIPS 186-x only
-#endif  // !NO_SIMDDIVIDE_M && NO_SIMDDIVIDE_L  //---------------------------
+#endif  // !NO_SIMDDIVIDE_M  //-----------------------------------------------
 
 
-#if 0   // FIPS 186-x only
+#if !defined(NO_SIMD_FIPS186PRIME)   // FIPS 186-x only
 #if !defined(NO_SIMDDIVIDE_L)  //--------------------------------------------
 /*--------------------------------------
  * large-table equivalent of simd_advance_rest_v_s()
@@ -1899,6 +2811,9 @@ void simd_advance_all_s(struct PP_Mod16bit *ps, uint16_t adv)
 {
 	state_advance_nr(ps, adv);
 
+#if !defined(NO_SIMD_NARROW8)
+	simd_advance_narrow8(ps, (uint8_t) adv);
+#endif
 	simd_advance_remainders_first(ps, adv);
 	simd_advance_remainders_rest(ps, adv);
 }
@@ -1914,6 +2829,9 @@ void simd_advance_all_m(struct PP_Mod16bit *ps, uint16_t adv)
 {
 	state_advance_nr(ps, adv);
 
+#if !defined(NO_SIMD_NARROW8)
+	simd_advance_narrow8(ps, (uint8_t) adv);
+#endif
 	simd_advance_remainders_first(ps, adv);
 	simd_advance_remainders_rest_m(ps, adv);
 }
@@ -1929,11 +2847,34 @@ void simd_advance_all_l(struct PP_Mod16bit *ps, uint16_t adv)
 {
 	state_advance_nr(ps, adv);
 
+#if !defined(NO_SIMD_NARROW8)
+	simd_advance_narrow8(ps, (uint8_t) adv);
+#endif
 	simd_advance_remainders_first(ps, adv);
 	simd_advance_remainders_rest_l(ps, adv);
 }
 
 
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+/*-----------------------------------------
+ * generated-size equivalent of simd_advance_all()
+ */
+static inline
+REALLY_FORCE_INLINE
+//
+void simd_advance_all_c(struct PP_Mod16bit *ps, uint16_t adv)
+{
+	state_advance_nr(ps, adv);
+
+#if !defined(NO_SIMD_NARROW8)
+	simd_advance_narrow8(ps, (uint8_t) adv);
+#endif
+	simd_advance_remainders_first(ps, adv);
+	simd_advance_remainders_rest_c(ps, adv);
+}
+#endif   // SIMDPRIME_COUNT_CUSTOM  ------------------------------------------
+
+
 /*-----------------------------------------
  * autoselects size from ps->mode
  */
@@ -1961,13 +2902,96 @@ void simd_advance_all(struct PP_Mod16bit *ps, uint16_t adv)
 		break;
 #endif
 
-	default:
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+	case SIMD_SEARCHTABLE_C:
+		simd_advance_all_c(ps, adv);
 		break;
-	}
+#endif
+
+	default:
+		break;
+	}
 }
 
 
-#if 0
+/*-----------------------------------------
+ * advance state by an arbitrary 'delta' in one pass per prime:
+ * folds (delta mod P) into modn[] without stepping through the range
+ *
+ * keeps the < 0x8000 table invariant: both modn[] entries and the
+ * per-prime deltas are < 0x8000, so sums fit uint16_t and one
+ * m2range() reduction restores the range
+ *
+ * the scalar (delta mod P) pass is cold-path only; all per-candidate
+ * advances keep using the constant-advance kernels above
+ *
+ * autoselects size from ps->mode
+ *
+ * returns updated least-significant u64, as state_advance_nr()
+ */
+static uint64_t state_jump(struct PP_Mod16bit *ps, uint64_t delta)
+{
+	SIMD_ALIGN uint16_t d16[ SIMDPRIME_COUNT ];
+	unsigned int g, i, count = 0;
+	uint64_t rc = 0;
+
+	switch (ps ? (ps->mode & SIMD_SEARCHTABLE_MASK) : 0) {
+#if !defined(NO_SIMDDIVIDE_S)
+	case SIMD_SEARCHTABLE_S:
+		count = 576;
+		break;
+#endif
+
+#if !defined(NO_SIMDDIVIDE_M)
+	case SIMD_SEARCHTABLE_M:
+		count = 1856;
+		break;
+#endif
+
+#if !defined(NO_SIMDDIVIDE_L)
+	case SIMD_SEARCHTABLE_L:
+		count = 3456;
+		break;
+#endif
+
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+	case SIMD_SEARCHTABLE_C:
+		count = SIMDPRIME_COUNT_CUSTOM;
+		break;
+#endif
+
+	default:
+		break;
+	}
+
+	if (count) {
+		for (i=0; i<count; ++i)
+			d16[i] = (uint16_t) (delta % firstprimes[i]);
+
+		for (g=0; g<count/64; ++g) {
+			simd_advance64x16_m2r_inpl_v(&(ps->modn[ g*64 ]),
+			                                  &(d16[ g*64 ]),
+			           &(firstprimes_mod2range_simd[ g*64 ]));
+		}
+
+		ps->offset += delta;
+		ps->lsb    += delta;
+		ps->mod6   =  (ps->mod6 + (unsigned int) (delta % 6)) % 6;
+
+#if !defined(NO_SIMD_NARROW8)
+		simd_narrow8_refresh(ps);
+#endif
+
+		rc = ps->lsb;
+
+		wipe(d16, sizeof(d16));
+	}
+
+	return rc;
+}
+
+
+#if !defined(NO_SIMD_FIPS186PRIME)
 // FIPS 186-x only
 
 /*-----------------------------------------
@@ -2013,6 +3037,10 @@ void simd_advance_rest_v_aw(struct PP_Mod16bit *ps)
  * SECURITY NOTE: tmp[] and tmp2[] are scratch, filled with
  * (potentially)secret state-dependent data, and SHOULD be wiped upon return.
  */
+#if defined(SIMD_STATS)
+#undef simd_no_spfactor64x16      // do not rewrite the definition itself
+#endif
+//
 static inline
 REALLY_FORCE_INLINE
 /**/
@@ -2036,6 +3064,11 @@ uint16_t simd_no_spfactor64x16(uint16_t tmp[static 64],
 
 	return simd_is_all0x64x16_inpl(tmp, tm2);
 }
+//
+#if defined(SIMD_STATS)           // later callers go through the shim again
+#define simd_no_spfactor64x16(tmp, tm2, modn, inv, limit)  \
+        simd_stats_no_spfactor64x16((tmp), (tm2), (modn), (inv), (limit))
+#endif   // SIMD_STATS
 #endif   //-----  /delimiter: generated SIMD columns  ------------------------
 
 
@@ -2110,6 +3143,32 @@ uint16_t simd_no_twinfactor64x16(uint16_t tmp[static 64],
 }
 
 
+#if defined(SIMD_STATS)
+//--------------------------------------
+// counting shim; see simd_stats_nofactor64x16()
+//
+static inline
+uint16_t simd_stats_no_twinfactor64x16(uint16_t tmp[static 64],
+                                      uint16_t tmp2[static 64],
+                                const uint16_t modn[static 64],
+                                 const uint16_t inv[static 64],
+                               const uint16_t limit[static 64])
+{
+	uint16_t rc = simd_no_twinfactor64x16(tmp, tmp2, modn, inv, limit);
+	size_t g = ((size_t) (inv - firstprimes_inverse_simd)) /64;
+
+	++simd_stats.checked[g];
+	if (!rc)
+		++simd_stats.rejected[g];
+
+	return rc;
+}
+//
+#define simd_no_twinfactor64x16(tmp, tm2, modn, inv, limit)  \
+        simd_stats_no_twinfactor64x16((tmp), (tm2), (modn), (inv), (limit))
+#endif   // SIMD_STATS
+
+
 // included by any of the L/XL versions, therefore not ..._S conditional
 /*--------------------------------------
  * is there a factor of x or x+2, after the first 64 primes have
@@ -2159,7 +3218,7 @@ uint16_t simd_no_twinfactor_rest(uint16_t tmp[  64 ],
 }
 
 
-#if !defined(NO_SIMDDIVIDE_M) && !defined(NO_SIMDDIVIDE_L)  //---------------
+#if !defined(NO_SIMDDIVIDE_M)  //---------------------------------------------
 /*--------------------------------------
  * simd_no_twinfactor_rest() equivalent with mid-sized prime table
  */
@@ -2252,7 +3311,7 @@ uint16_t simd_no_twinfactor_rest_m(uint16_t tmp[   64 ],
 	                      &(firstprimes_inverse_simd[ 1792 ]),
 	                     &(firstprimes_mullimit_simd[ 1792 ])));
 }
-#endif    // !NO_SIMDDIVIDE_M && !NO_SIMDDIVIDE_L  --------------------------
+#endif    // !NO_SIMDDIVIDE_M  -----------------------------------------------
 
 
 #if !defined(NO_SIMDDIVIDE_L)  //--------------------------------------------
@@ -2369,6 +3428,32 @@ uint16_t simd_no_twinfactor_rest_l(uint16_t tmp[   64 ],
 	                     &(firstprimes_mullimit_simd[ 3392 ])));
 }
 #endif    // !NO_SIMDDIVIDE_L  ----------------------------------------------
+
+
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+/*--------------------------------------
+ * generated-size version of simd_no_twinfactor_rest(): checks primes
+ * [64, SIMDPRIME_COUNT_CUSTOM) in a compile-time bounded loop
+ */
+static inline
+REALLY_FORCE_INLINE
+/**/
+uint16_t simd_no_twinfactor_rest_c(uint16_t tmp[   64 ],
+                                   uint16_t tm2[   64 ],
+                            const uint16_t modn[ SIMDPRIME_COUNT_CUSTOM ])
+{
+	unsigned int g;
+
+	for (g=64; g<SIMDPRIME_COUNT_CUSTOM; g+=64) {
+		if (!simd_no_twinfactor64x16(tmp, tm2, &(modn[ g ]),
+		                  &(firstprimes_inverse_simd[ g ]),
+		                 &(firstprimes_mullimit_simd[ g ])))
+			return 0;
+	}
+
+	return 1;
+}
+#endif   // SIMDPRIME_COUNT_CUSTOM  ------------------------------------------
 #endif    // !NO_SIMD_TWINPRIME  ---------------------------------------------
 
 
@@ -2394,6 +3479,10 @@ static unsigned long report_current_lsb(uint64_t *lsb,    unsigned long elems,
 	if (lsb && (wr < elems))
 		lsb[wr] = current;
 
+#if defined(SIMD_STATS)
+	++simd_stats.survivors;
+#endif
+
 	return ++wr;
 }
 
@@ -2492,6 +3581,12 @@ unsigned long init_search(const uint64_t *lsb, unsigned long count,
 		break;
 #endif
 
+#if !defined(NO_SIMD_FIPS186PRIME)
+	case SIMD_PRIMETYPE_FIPS186:
+		break;          // sequence is fixed by c0 + j*increment;
+		                // start exactly at c0
+#endif
+
 	default:
 #if !defined(NO_SIMD_PLAINPRIME)
 		scan_pkcs1_init(dst, dst);
@@ -2512,6 +3607,11 @@ uint16_t simd_has_no_factor(uint16_t tmp[static 64],
                             uint16_t tm2[static 64],
             const struct PP_Mod16bit *ps)
 {
+#if !defined(NO_SIMD_NARROW8)
+	if (!simd_nofactor8_first((uint8_t *) tmp, ps))
+		return 0;            // small factor among [5..139]
+#endif
+
 	return (simd_nofactor_first(tmp, tm2, ps) &&
 	        simd_nofactor_rest_s(tmp, tm2, ps)) ;
 }
@@ -2546,6 +3646,11 @@ uint16_t simd_has_no_factor_m(uint16_t tmp[static 64],
                               uint16_t tm2[static 64],
               const struct PP_Mod16bit *ps)
 {
+#if !defined(NO_SIMD_NARROW8)
+	if (!simd_nofactor8_first((uint8_t *) tmp, ps))
+		return 0;            // small factor among [5..139]
+#endif
+
 	return (simd_nofactor_first(tmp, tm2, ps) &&
 	        simd_nofactor_rest_m(tmp, tm2, ps)) ;
 }
@@ -2584,6 +3689,11 @@ uint16_t simd_has_no_factor_l(uint16_t tmp[static 64],
                               uint16_t tm2[static 64],
               const struct PP_Mod16bit *ps)
 {
+#if !defined(NO_SIMD_NARROW8)
+	if (!simd_nofactor8_first((uint8_t *) tmp, ps))
+		return 0;            // small factor among [5..139]
+#endif
+
 	return (simd_nofactor_first(tmp, tm2, ps) &&
 	        simd_nofactor_rest_l(tmp, tm2, ps)) ;
 }
@@ -2611,6 +3721,71 @@ unsigned long simd_check_plain1_l(uint64_t *lsb, unsigned long count,
 #endif   // !NO_SIMDDIVIDE_L  -----------------------------------------------
 
 
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+/*--------------------------------------
+ * is the current state divided by any of the first
+ * SIMDPRIME_COUNT_CUSTOM primes?
+ */
+static inline
+uint16_t simd_has_no_factor_c(uint16_t tmp[static 64],
+                              uint16_t tm2[static 64],
+              const struct PP_Mod16bit *ps)
+{
+#if !defined(NO_SIMD_NARROW8)
+	if (!simd_nofactor8_first((uint8_t *) tmp, ps))
+		return 0;            // small factor among [5..139]
+#endif
+
+	return (simd_nofactor_first(tmp, tm2, ps) &&
+	        simd_nofactor_rest_c(tmp, tm2, ps)) ;
+}
+
+
+/*--------------------------------------
+ * does the current 'ps' have a factor in the generated-size list?
+ *
+ * possibly write one more LSB64 to (lsb, count), if no factor
+ *
+ * returns updated 'wr', which may be original input or +1
+ */
+static inline
+unsigned long simd_check_plain1_c(uint64_t *lsb, unsigned long count,
+                             unsigned long wr,
+                                  uint16_t tmp[static 64],
+                                  uint16_t tm2[static 64],
+                  const struct PP_Mod16bit *ps)
+{
+	if (simd_has_no_factor_c(tmp, tm2, ps))
+		wr = report_current_lsb(lsb, count, ps->lsb, wr);
+
+	return wr;
+}
+#endif   // SIMDPRIME_COUNT_CUSTOM  ------------------------------------------
+
+
+/*--------------------------------------
+ * widest configured full-table check; see simd_has_no_factor()
+ */
+static inline
+uint16_t simd_has_no_factor_w(uint16_t tmp[static 64],
+                              uint16_t tm2[static 64],
+              const struct PP_Mod16bit *ps)
+{
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+	return simd_has_no_factor_c(tmp, tm2, ps);
+
+#elif !defined(NO_SIMDDIVIDE_L)
+	return simd_has_no_factor_l(tmp, tm2, ps);
+
+#elif !defined(NO_SIMDDIVIDE_M)
+	return simd_has_no_factor_m(tmp, tm2, ps);
+
+#else
+	return simd_has_no_factor(tmp, tm2, ps);
+#endif
+}
+
+
 #if 0
 /*--------------------------------------
  * autoselect size from
@@ -2633,6 +3808,10 @@ unsigned long simd_check_plain(uint64_t *lsb, unsigned long count,
  * registering initial state (which must have been 6k+5 if it has been
  * rechecked)
  *
+ * the 6k+5 check runs at the caller's own table depth -- one clone per
+ * size, as with the loop bodies -- so park-and-resume callers (see
+ * sink_advance()) replay a continuous scan exactly
+ *
  * possibly updates both 'ps' and 'adv'
  */
 static inline
@@ -2640,128 +3819,233 @@ unsigned long plain_advance_to_6kp1(uint64_t *lsb, unsigned long count,
                           struct PP_Mod16bit *ps,
 	                 struct SIMD_Advance *adv)
 {
-	static unsigned long rv = 0;
-
 	if (ps && adv && (ps->mod6 == 5)) {         // advance 6k+5 -> 6(k+1)+1
 		adv->wr = simd_check_plain1(lsb, count, adv->wr,
 		                            adv->tmp, adv->tm2, ps);
 
 		simd_advance_all(ps, 2);
-		rv = adv->wr;
 	}
 
-	return rv;
+	return adv ? adv->wr : 0;
+}
+
+
+#if !defined(NO_SIMDDIVIDE_M) && defined(NO_SIMDDIVIDE_L)
+//--------------------------------------
+static inline
+unsigned long plain_advance_to_6kp1_m(uint64_t *lsb, unsigned long count,
+                            struct PP_Mod16bit *ps,
+	                   struct SIMD_Advance *adv)
+{
+	if (ps && adv && (ps->mod6 == 5)) {         // advance 6k+5 -> 6(k+1)+1
+		adv->wr = simd_check_plain1_m(lsb, count, adv->wr,
+		                             adv->tmp, adv->tm2, ps);
+
+		simd_advance_all(ps, 2);
+	}
+
+	return adv ? adv->wr : 0;
+}
+#endif   // !NO_SIMDDIVIDE_M && NO_SIMDDIVIDE_L
+
+
+#if !defined(NO_SIMDDIVIDE_L)
+//--------------------------------------
+static inline
+unsigned long plain_advance_to_6kp1_l(uint64_t *lsb, unsigned long count,
+                            struct PP_Mod16bit *ps,
+	                   struct SIMD_Advance *adv)
+{
+	if (ps && adv && (ps->mod6 == 5)) {         // advance 6k+5 -> 6(k+1)+1
+		adv->wr = simd_check_plain1_l(lsb, count, adv->wr,
+		                             adv->tmp, adv->tm2, ps);
+
+		simd_advance_all(ps, 2);
+	}
+
+	return adv ? adv->wr : 0;
+}
+#endif   // !NO_SIMDDIVIDE_L
+
+
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+//--------------------------------------
+static inline
+unsigned long plain_advance_to_6kp1_c(uint64_t *lsb, unsigned long count,
+                            struct PP_Mod16bit *ps,
+	                   struct SIMD_Advance *adv)
+{
+	if (ps && adv && (ps->mod6 == 5)) {         // advance 6k+5 -> 6(k+1)+1
+		adv->wr = simd_check_plain1_c(lsb, count, adv->wr,
+		                             adv->tmp, adv->tm2, ps);
+
+		simd_advance_all(ps, 2);
+	}
+
+	return adv ? adv->wr : 0;
 }
+#endif   // SIMDPRIME_COUNT_CUSTOM
 
 
-#if defined(NO_SIMDDIVIDE_M) && defined(NO_SIMDDIVIDE_L)  //-----------------
+#if defined(NO_SIMDDIVIDE_M) && defined(NO_SIMDDIVIDE_L) && \
+    !defined(SIMDPRIME_COUNT_CUSTOM)  //--------------------------------------
 //--------------------------------------
 static
+SIMD_ISA_CLONES
 uint64_t plain_advance_s(uint64_t *lsb, unsigned long count,
                struct PP_Mod16bit *dst,
          const struct PP_Mod16bit *src)
 {
-	struct SIMD_Advance adv = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
 
 	count = init_search(lsb, count, dst, src, 0);
 	if (!count)
 		return 0;
 
-	adv.wr = plain_advance_to_6kp1(lsb, count, dst, &adv);
+	adv->wr = plain_advance_to_6kp1(lsb, count, dst, adv);
 
-	while (adv.wr < count) {                // invariant: candidate is 6k+1
-		adv.wr = simd_check_plain1(lsb, count, adv.wr,
-		                           adv.tmp, adv.tm2, dst);
+	while ((adv->wr < count) &&
+	       scan_budget_ok(2)) {     // invariant: candidate is 6k+1
+		adv->wr = simd_check_plain1(lsb, count, adv->wr,
+		                           adv->tmp, adv->tm2, dst);
 
-		if (adv.wr < count) {
+		if (adv->wr < count) {
 			simd_advance_all(dst, 4);               // 6k+1 -> 6k+5
 
-			adv.wr = simd_check_plain1(lsb, count, adv.wr,
-			                           adv.tmp, adv.tm2, dst);
-			if (adv.wr < count)
+			adv->wr = simd_check_plain1(lsb, count, adv->wr,
+			                           adv->tmp, adv->tm2, dst);
+			if (adv->wr < count)
 				simd_advance_all(dst, 2);   // 6k+5 -> 6(k+1)+1
 		}
 	}
 
-	wipe_advance_struct(&adv);
+	advance_scratch_done(adv, &local);
 
 	return dst->lsb;
 }
 #endif   // NO_SIMDDIVIDE_M && NO_SIMDDIVIDE_L  -----------------------------
 
 
-#if !defined(NO_SIMDDIVIDE_M) && defined(NO_SIMDDIVIDE_L)  //----------------
+#if !defined(NO_SIMDDIVIDE_M) && defined(NO_SIMDDIVIDE_L) && \
+    !defined(SIMDPRIME_COUNT_CUSTOM)  //--------------------------------------
 //--------------------------------------
 static
+SIMD_ISA_CLONES
 uint64_t plain_advance_m(uint64_t *lsb, unsigned long count,
                struct PP_Mod16bit *dst,
          const struct PP_Mod16bit *src)
 {
-	struct SIMD_Advance adv = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
 
 	count = init_search(lsb, count, dst, src, 0);
 	if (!count)
 		return 0;
 
-	adv.wr = plain_advance_to_6kp1(lsb, count, dst, &adv);
+	adv->wr = plain_advance_to_6kp1_m(lsb, count, dst, adv);
 
-	while (adv.wr < count) {                // invariant: candidate is 6k+1
-		adv.wr = simd_check_plain1_m(lsb, count, adv.wr,
-		                             adv.tmp, adv.tm2, dst);
+	while ((adv->wr < count) &&
+	       scan_budget_ok(2)) {     // invariant: candidate is 6k+1
+		adv->wr = simd_check_plain1_m(lsb, count, adv->wr,
+		                             adv->tmp, adv->tm2, dst);
 
-		if (adv.wr < count) {
+		if (adv->wr < count) {
 			simd_advance_all(dst, 4);               // 6k+1 -> 6k+5
 
-			adv.wr = simd_check_plain1_m(lsb, count, adv.wr,
-		                                     adv.tmp, adv.tm2, dst);
-			if (adv.wr < count)
+			adv->wr = simd_check_plain1_m(lsb, count, adv->wr,
+		                                     adv->tmp, adv->tm2, dst);
+			if (adv->wr < count)
 				simd_advance_all(dst, 2);   // 6k+5 -> 6(k+1)+1
 		}
 	}
 
-	wipe_advance_struct(&adv);
+	advance_scratch_done(adv, &local);
 
 	return dst->lsb;
 }
 #endif   // !NO_SIMDDIVIDE_M && NO_SIMDDIVIDE_L  ----------------------------
 
 
-#if !defined(NO_SIMDDIVIDE_L)  //--------------------------------------------
+#if !defined(NO_SIMDDIVIDE_L) && \
+    !defined(SIMDPRIME_COUNT_CUSTOM)  //--------------------------------------
 //--------------------------------------
 static
+SIMD_ISA_CLONES
 uint64_t plain_advance_l(uint64_t *lsb, unsigned long count,
                 struct PP_Mod16bit *dst,
           const struct PP_Mod16bit *src)
 {
-	struct SIMD_Advance adv = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
 
 	count = init_search(lsb, count, dst, src, 0);
 	if (!count)
 		return 0;
 
-	adv.wr = plain_advance_to_6kp1(lsb, count, dst, &adv);
+	adv->wr = plain_advance_to_6kp1_l(lsb, count, dst, adv);
 
-	while (adv.wr < count) {                    // invariant: candidate is 6k+1
-		adv.wr = simd_check_plain1_l(lsb, count, adv.wr,
-		                              adv.tmp, adv.tm2, dst);
+	while ((adv->wr < count) &&
+	       scan_budget_ok(2)) {     // invariant: candidate is 6k+1
+		adv->wr = simd_check_plain1_l(lsb, count, adv->wr,
+		                              adv->tmp, adv->tm2, dst);
 
-		if (adv.wr < count) {
+		if (adv->wr < count) {
 			simd_advance_all(dst, 4);               // 6k+1 -> 6k+5
 
-			adv.wr = simd_check_plain1_l(lsb, count, adv.wr,
-		                                      adv.tmp, adv.tm2, dst);
-			if (adv.wr < count)
+			adv->wr = simd_check_plain1_l(lsb, count, adv->wr,
+		                                      adv->tmp, adv->tm2, dst);
+			if (adv->wr < count)
 				simd_advance_all(dst, 2);   // 6k+5 -> 6(k+1)+1
 		}
 	}
 
-	wipe_advance_struct(&adv);
+	advance_scratch_done(adv, &local);
 
 	return dst->lsb;
 }
 #endif   // !NO_SIMDDIVIDE_L  -----------------------------------------------
 
 
+#if defined(SIMDPRIME_COUNT_CUSTOM)  //---------------------------------------
+//--------------------------------------
+static
+SIMD_ISA_CLONES
+uint64_t plain_advance_c(uint64_t *lsb, unsigned long count,
+                struct PP_Mod16bit *dst,
+          const struct PP_Mod16bit *src)
+{
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+
+	count = init_search(lsb, count, dst, src, 0);
+	if (!count)
+		return 0;
+
+	adv->wr = plain_advance_to_6kp1_c(lsb, count, dst, adv);
+
+	while ((adv->wr < count) &&
+	       scan_budget_ok(2)) {     // invariant: candidate is 6k+1
+		adv->wr = simd_check_plain1_c(lsb, count, adv->wr,
+		                             adv->tmp, adv->tm2, dst);
+
+		if (adv->wr < count) {
+			simd_advance_all(dst, 4);               // 6k+1 -> 6k+5
+
+			adv->wr = simd_check_plain1_c(lsb, count, adv->wr,
+		                                     adv->tmp, adv->tm2, dst);
+			if (adv->wr < count)
+				simd_advance_all(dst, 2);   // 6k+5 -> 6(k+1)+1
+		}
+	}
+
+	advance_scratch_done(adv, &local);
+
+	return dst->lsb;
+}
+#endif   // SIMDPRIME_COUNT_CUSTOM  ------------------------------------------
+
+
 /*--------------------------------------
  * wrapper picking widest _advance() function
  */
@@ -2770,7 +4054,10 @@ uint64_t plain_advance(uint64_t *lsb, unsigned long count,
              struct PP_Mod16bit *dst,
        const struct PP_Mod16bit *src)
 {
-#if !defined(NO_SIMDDIVIDE_L)
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+	return plain_advance_c(lsb, count, dst, src);
+
+#elif !defined(NO_SIMDDIVIDE_L)
 	return plain_advance_l(lsb, count, dst, src);
 
 #elif !defined(NO_SIMDDIVIDE_M)
@@ -2780,709 +4067,4572 @@ uint64_t plain_advance(uint64_t *lsb, unsigned long count,
 	return plain_advance_s(lsb, count, dst, src);
 #endif
 }
-#endif  //-----  !NO_SIMD_PLAINPRIME  ----------------------------------------
-
 
-#if !defined(NO_SIMD_TWINPRIME) && !defined(NO_SIMD_SAFEPRIME)  //------------
-// shared code: twin primes, safe primes
 
-//--------------------------------------
-// both safe prime and twin-prime search is restricted to p=6k+5
-// advance to potential start position
+#if !defined(NO_SIMD_WHEEL210)  //-----  wheel-210 stepping  -----------------
+// plain search stepping a 2*3*5*7 wheel: only the 48 residues mod 210
+// coprime to the wheel are ever materialized, so multiples of 5 and 7
+// never reach the divisibility pass (roughly 3 in 10 of the 6k+-1
+// candidates)
 //
-static void scan_twin_or_safeprime(struct PP_Mod16bit *dst,
-                             const struct PP_Mod16bit *src)
-{
-	if (dst) {
-		uint16_t adv;
+// the maximal wheel gap is 10, so all advances stay well within the
+// m2range reduction invariant; see simd_advance16x16_m2r_inpl()
 
-		scan_inherit_or0(dst, src);
+/*--------------------------------------
+ * distance to the nearest residue coprime to 210 at-or-after 'r210'
+ * (0 if already coprime); wheel equivalent of prime_mod6_advance()
+ */
+static const uint8_t wheel210_align[ 210 ] = {
+	1, 0, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 1, 0, 3, 2,
+	1, 0, 1, 0, 3, 2, 1, 0, 5, 4, 3, 2, 1, 0, 1, 0,
+	5, 4, 3, 2, 1, 0, 3, 2, 1, 0, 1, 0, 3, 2, 1, 0,
+	5, 4, 3, 2, 1, 0, 5, 4, 3, 2, 1, 0, 1, 0, 5, 4,
+	3, 2, 1, 0, 3, 2, 1, 0, 1, 0, 5, 4, 3, 2, 1, 0,
+	3, 2, 1, 0, 5, 4, 3, 2, 1, 0, 7, 6, 5, 4, 3, 2,
+	1, 0, 3, 2, 1, 0, 1, 0, 3, 2, 1, 0, 1, 0, 3, 2,
+	1, 0, 7, 6, 5, 4, 3, 2, 1, 0, 5, 4, 3, 2, 1, 0,
+	3, 2, 1, 0, 5, 4, 3, 2, 1, 0, 1, 0, 3, 2, 1, 0,
+	5, 4, 3, 2, 1, 0, 1, 0, 5, 4, 3, 2, 1, 0, 5, 4,
+	3, 2, 1, 0, 3, 2, 1, 0, 1, 0, 3, 2, 1, 0, 5, 4,
+	3, 2, 1, 0, 1, 0, 5, 4, 3, 2, 1, 0, 3, 2, 1, 0,
+	1, 0, 3, 2, 1, 0, 1, 0, 9, 8, 7, 6, 5, 4, 3, 2,
+	1, 0,
+} ;
 
-		adv = (11 - dst->mod6) % 6;                  // advance to 6k+5
 
-		simd_advance_all(dst, adv);
-	}
+/*--------------------------------------
+ * current-state residue mod 210, by CRT from mod6 and the stored
+ * mod-5/mod-7 remainders (firstprimes[] starts with 5, 7)
+ *
+ * 175/126/120 are == 1 modulo exactly one of 6/5/7, == 0 mod the others
+ */
+static unsigned int wheel210_residue(const struct PP_Mod16bit *ps)
+{
+	return ((ps->mod6    % 6) * 175 +
+	        (ps->modn[0] % 5) * 126 +
+	        (ps->modn[1] % 7) * 120) % 210;
 }
-#endif   //-----  !NO_SIMD_TWINPRIME && !NO_SIMD_SAFEPRIME  ------------------
 
 
-#if !defined(NO_SIMD_TWINPRIME)  //---- twin prime: u and (u + 2) primes -----
-// scanning primes of form 6k+5, for 'twin primes' where 6k+7 may also
-// be a prime
+/*--------------------------------------
+ * gap from a coprime residue to the next one, wrapping mod 210
+ */
+static inline unsigned int wheel210_step(unsigned int r210)
+{
+	return 1 + wheel210_align[ (r210 + 1) % 210 ];
+}
 
-#if defined(NO_SIMDDIVIDE_M) && defined(NO_SIMDDIVIDE_L)  //-----------------
-// small prime-table
-//
+
+#if defined(NO_SIMDDIVIDE_M) && defined(NO_SIMDDIVIDE_L) && \
+    !defined(SIMDPRIME_COUNT_CUSTOM)  //--------------------------------------
+//--------------------------------------
 static
-uint64_t twin_advance_s(uint64_t *lsb, unsigned long count,
-              struct PP_Mod16bit *dst,
-        const struct PP_Mod16bit *src)
+SIMD_ISA_CLONES
+uint64_t wheel_advance_s(uint64_t *lsb, unsigned long count,
+                struct PP_Mod16bit *dst,
+          const struct PP_Mod16bit *src)
 {
-	struct SIMD_Advance adv = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+	unsigned int r210;
 
-	count = init_search(lsb, count, dst, src, SIMD_PRIMETYPE_TWIN);
+	count = init_search(lsb, count, dst, src, 0);
 	if (!count)
 		return 0;
 
-	for (adv.wr=0; adv.wr<count; ) {
-		unsigned int skip = 0;
+	r210 = wheel210_residue(dst);
+					// align to first coprime residue;
+					// no 210-coprime candidate is skipped
+	if (wheel210_align[ r210 ]) {
+		simd_advance_all(dst, wheel210_align[ r210 ]);
 
-		// advance to first index which MAY be a prime based on
-		// first N small primes, or adv is >= 2^16
+		r210 = (r210 + wheel210_align[ r210 ]) % 210;
+	}
 
-		// count advances (6*number of elems tested)
-		// up to 2^15 addition total
-		//
-		// this advance can still be added to mod-prime
-		// array elems without generating carries
+	while ((adv->wr < count) &&
+	       scan_budget_ok(1)) {   // invariant: gcd(candidate,210)==1
+		unsigned int a;
 
-		while (!(skip >> 14) &&
-		       !simd_no_twinfactor64x16(adv.tmp, adv.tm2, dst->modn,
-		                                firstprimes_inverse_simd,
-		                                firstprimes_mullimit_simd))
-		{
-			simd_advance64x16_m2r_inpl(dst->modn, 6,
-			                      firstprimes_mod2range_simd);
-			skip += 6;
-		}
-
-		state_advance_nr(dst, skip);
-
-					// only first 64 have been advanced
-					// now advance entries >64,
-		if (skip)
-			simd_advance_remainders_rest(dst, skip);
-
-		if (skip >> 14)
-			continue;
+		adv->wr = simd_check_plain1(lsb, count, adv->wr,
+		                           adv->tmp, adv->tm2, dst);
+		if (adv->wr >= count)
+			break;
 
-		if (simd_no_twinfactor_rest(adv.tmp, adv.tm2, dst->modn)) {
-			adv.wr = report_current_lsb(lsb, count,
-			                            dst->lsb, adv.wr);
-		}
+		a = wheel210_step(r210);
 
-		simd_advance_all(dst, 6);
+		simd_advance_all(dst, (uint16_t) a);
+		r210 = (r210 + a) % 210;
 	}
 
-	wipe_advance_struct(&adv);
+	advance_scratch_done(adv, &local);
 
 	return dst->lsb;
 }
-#endif    // NO_SIMDDIVIDE_M && NO_SIMDDIVIDE_L  ----------------------------
+#endif   // NO_SIMDDIVIDE_M && NO_SIMDDIVIDE_L  -----------------------------
 
 
-#if !defined(NO_SIMDDIVIDE_M) && defined(NO_SIMDDIVIDE_L)  //----------------
-/*--------------------------------------
- * mid-sized prime table, equivalent of twin_advance()
- */
+#if !defined(NO_SIMDDIVIDE_M) && defined(NO_SIMDDIVIDE_L) && \
+    !defined(SIMDPRIME_COUNT_CUSTOM)  //--------------------------------------
+//--------------------------------------
 static
-uint64_t twin_advance_m(uint64_t *lsb, unsigned long count,
-              struct PP_Mod16bit *dst,
-        const struct PP_Mod16bit *src)
+SIMD_ISA_CLONES
+uint64_t wheel_advance_m(uint64_t *lsb, unsigned long count,
+                struct PP_Mod16bit *dst,
+          const struct PP_Mod16bit *src)
 {
-	struct SIMD_Advance adv = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+	unsigned int r210;
 
-	count = init_search(lsb, count, dst, src, SIMD_PRIMETYPE_TWIN);
+	count = init_search(lsb, count, dst, src, 0);
 	if (!count)
 		return 0;
 
-	for (adv.wr=0; adv.wr<count; ) {
-		unsigned int skip = 0;
-
-		// advance to first index which MAY be a prime based on
-		// first N small primes, or adv is >= 2^16
-
-		// count advances (6*number of elems tested)
-		// up to 2^15 addition total
-		//
-		// this advance can still be added to mod-prime
-		// array elems without generating carries
-
-		while (!(skip >> 14) &&
-		       !simd_no_twinfactor64x16(adv.tmp, adv.tm2, dst->modn,
-		                                firstprimes_inverse_simd,
-		                                firstprimes_mullimit_simd))
-		{
-			simd_advance64x16_m2r_inpl(dst->modn, 6,
-			                      firstprimes_mod2range_simd);
-			skip += 6;
-		}
+	r210 = wheel210_residue(dst);
+					// align to first coprime residue;
+					// no 210-coprime candidate is skipped
+	if (wheel210_align[ r210 ]) {
+		simd_advance_all(dst, wheel210_align[ r210 ]);
 
-		state_advance_nr(dst, skip);
+		r210 = (r210 + wheel210_align[ r210 ]) % 210;
+	}
 
-					// only first 64 have been advanced
-					// now advance entries >64,
-		if (skip)
-			simd_advance_remainders_rest_m(dst, skip);
+	while ((adv->wr < count) &&
+	       scan_budget_ok(1)) {   // invariant: gcd(candidate,210)==1
+		unsigned int a;
 
-		if (skip >> 14)
-			continue;
+		adv->wr = simd_check_plain1_m(lsb, count, adv->wr,
+		                             adv->tmp, adv->tm2, dst);
+		if (adv->wr >= count)
+			break;
 
-		if (simd_no_twinfactor_rest_m(adv.tmp, adv.tm2, dst->modn)) {
-			adv.wr = report_current_lsb(lsb, count,
-			                            dst->lsb, adv.wr);
-		}
+		a = wheel210_step(r210);
 
-		simd_advance_all(dst, 6);
+		simd_advance_all(dst, (uint16_t) a);
+		r210 = (r210 + a) % 210;
 	}
 
-	wipe_advance_struct(&adv);
+	advance_scratch_done(adv, &local);
 
 	return dst->lsb;
 }
-#endif    // !NO_SIMDDIVIDE_M && NO_SIMDDIVIDE_L  ---------------------------
+#endif   // !NO_SIMDDIVIDE_M && NO_SIMDDIVIDE_L  ----------------------------
 
 
-#if !defined(NO_SIMDDIVIDE_L)  //--------------------------------------------
-/*--------------------------------------
- * large prime table, equivalent of twin_advance()
- */
+#if !defined(NO_SIMDDIVIDE_L) && \
+    !defined(SIMDPRIME_COUNT_CUSTOM)  //--------------------------------------
+//--------------------------------------
 static
-uint64_t twin_advance_l(uint64_t *lsb, unsigned long count,
-               struct PP_Mod16bit *dst,
-         const struct PP_Mod16bit *src)
+SIMD_ISA_CLONES
+uint64_t wheel_advance_l(uint64_t *lsb, unsigned long count,
+                struct PP_Mod16bit *dst,
+          const struct PP_Mod16bit *src)
 {
-	struct SIMD_Advance adv = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+	unsigned int r210;
 
-	count = init_search(lsb, count, dst, src, SIMD_PRIMETYPE_TWIN);
+	count = init_search(lsb, count, dst, src, 0);
 	if (!count)
 		return 0;
 
-	for (adv.wr=0; adv.wr<count; ) {
-		unsigned int skip = 0;
+	r210 = wheel210_residue(dst);
+					// align to first coprime residue;
+					// no 210-coprime candidate is skipped
+	if (wheel210_align[ r210 ]) {
+		simd_advance_all(dst, wheel210_align[ r210 ]);
 
-		// advance to first index which MAY be a prime based on
-		// first N small primes, or adv is >= 2^16
+		r210 = (r210 + wheel210_align[ r210 ]) % 210;
+	}
 
-		// count advances (6*number of elems tested)
-		// up to 2^15 addition total
-		//
-		// this advance can still be added to mod-prime
-		// array elems without generating carries
+	while ((adv->wr < count) &&
+	       scan_budget_ok(1)) {   // invariant: gcd(candidate,210)==1
+		unsigned int a;
 
-		while (!(skip >> 14) &&
-		       !simd_no_twinfactor64x16(adv.tmp, adv.tm2, dst->modn,
-		                                firstprimes_inverse_simd,
-		                                firstprimes_mullimit_simd))
-		{
-			simd_advance64x16_m2r_inpl(dst->modn, 6,
-			                      firstprimes_mod2range_simd);
-			skip += 6;
-		}
+		adv->wr = simd_check_plain1_l(lsb, count, adv->wr,
+		                              adv->tmp, adv->tm2, dst);
+		if (adv->wr >= count)
+			break;
 
-		state_advance_nr(dst, skip);
+		a = wheel210_step(r210);
 
-					// only first 64 have been advanced
-					// now advance entries >64,
-		if (skip)
-			simd_advance_remainders_rest_l(dst, skip);
+		simd_advance_all(dst, (uint16_t) a);
+		r210 = (r210 + a) % 210;
+	}
 
-		if (skip >> 14)
-			continue;
+	advance_scratch_done(adv, &local);
 
-		if (simd_no_twinfactor_rest_l(adv.tmp, adv.tm2, dst->modn)) {
-			adv.wr = report_current_lsb(lsb, count,
-			                            dst->lsb, adv.wr);
-		}
+	return dst->lsb;
+}
+#endif   // !NO_SIMDDIVIDE_L  -----------------------------------------------
 
-		simd_advance_all(dst, 6);
+
+#if defined(SIMDPRIME_COUNT_CUSTOM)  //---------------------------------------
+//--------------------------------------
+static
+SIMD_ISA_CLONES
+uint64_t wheel_advance_c(uint64_t *lsb, unsigned long count,
+                struct PP_Mod16bit *dst,
+          const struct PP_Mod16bit *src)
+{
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+	unsigned int r210;
+
+	count = init_search(lsb, count, dst, src, 0);
+	if (!count)
+		return 0;
+
+	r210 = wheel210_residue(dst);
+					// align to first coprime residue;
+					// no 210-coprime candidate is skipped
+	if (wheel210_align[ r210 ]) {
+		simd_advance_all(dst, wheel210_align[ r210 ]);
+
+		r210 = (r210 + wheel210_align[ r210 ]) % 210;
 	}
 
-	wipe_advance_struct(&adv);
+	while ((adv->wr < count) &&
+	       scan_budget_ok(1)) {   // invariant: gcd(candidate,210)==1
+		unsigned int a;
+
+		adv->wr = simd_check_plain1_c(lsb, count, adv->wr,
+		                             adv->tmp, adv->tm2, dst);
+		if (adv->wr >= count)
+			break;
+
+		a = wheel210_step(r210);
+
+		simd_advance_all(dst, (uint16_t) a);
+		r210 = (r210 + a) % 210;
+	}
+
+	advance_scratch_done(adv, &local);
 
 	return dst->lsb;
 }
-#endif   // !NO_SIMDDIVIDE_L  -----------------------------------------------
+#endif   // SIMDPRIME_COUNT_CUSTOM  ------------------------------------------
 
 
 /*--------------------------------------
  * wrapper picking widest _advance() function
  */
 static inline
-uint64_t twin_advance_w(uint64_t *lsb, unsigned long count,
-              struct PP_Mod16bit *dst,
-        const struct PP_Mod16bit *src)
+uint64_t wheel_advance(uint64_t *lsb, unsigned long count,
+             struct PP_Mod16bit *dst,
+       const struct PP_Mod16bit *src)
 {
-#if !defined(NO_SIMDDIVIDE_L)
-	return twin_advance_l(lsb, count, dst, src);
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+	return wheel_advance_c(lsb, count, dst, src);
+
+#elif !defined(NO_SIMDDIVIDE_L)
+	return wheel_advance_l(lsb, count, dst, src);
 
 #elif !defined(NO_SIMDDIVIDE_M)
-	return twin_advance_m(lsb, count, dst, src);
+	return wheel_advance_m(lsb, count, dst, src);
 
 #else
-	return twin_advance_s(lsb, count, dst, src);
+	return wheel_advance_s(lsb, count, dst, src);
 #endif
 }
-#endif   //-----  !NO_SIMD_TWINPRIME)  ---------------------------------------
+#endif  //-----  !NO_SIMD_WHEEL210  ------------------------------------------
 
 
-#if !defined(NO_SIMD_SAFEPRIME)  //-------------------------------------------
+#if !defined(NO_SIMD_WINDOWED)  //-----  two-phase windowed compaction  -------
+// plain search split across whole candidate windows: phase 1 runs only
+// the front filters (8-bit lanes plus the first 64 primes) over every
+// candidate, compacting survivor offsets into a dense list; phase 2
+// advances the rest-table lanes survivor to survivor over that list, so
+// the wide rest-group chains never see candidates the front already
+// rejected
+//
+// a window of 1024 candidates advances by alternating 4+2, 3072 total,
+// so both the uint16_t survivor offsets and the deferred rest-table
+// advances stay well below the 2^14 ceiling the twin/safe scanners
+// already rely on; see simd_advance16x16_m2r_inpl()
+
+#define SIMD_WINDOW_CANDIDATES  ((unsigned int) 1024)
 
-#if !defined(NO_SIMDDIVIDE_S)  //---------------------------------------------
 /*--------------------------------------
- * list possible ls64(Q) of values where both Q and 2Q+1 MAY be primes
- * (have no small factors in our list of small primes)
- * [main entry point]
- *
- * advances from 'src' to 'dst'
- *
- * if non-NULL, fill lsb[] with 'count' next lsb64(Q) values,
- * in increasing order.
- * NOTE: WE DO NOT TRACK WRAPAROUND AT 2^64 BOUNDARIES.
- *
- * NULL 'lsb' returns the next possible lsb64(Q), and advances 'dst'
- * to next possible candidate.
- *
- * returns the last lsb64(Q) enumerated.
- *
- * 'src' and 'dst' may be the same struct
+ * phase-1 advance: step only the front of the state (counters, 8-bit
+ * lanes, first 64 primes); rest-table lanes catch up lazily in phase 2
  */
-static
-uint64_t sfsieve_advance_s(uint64_t *lsb, unsigned long count,
-                 struct PP_Mod16bit *dst,
-           const struct PP_Mod16bit *src)
+static inline
+void simd_window_advance_front(struct PP_Mod16bit *ps, uint16_t adv)
 {
-	struct SIMD_Advance adv = SIMD_ADVANCE_INIT0;
+	state_advance_nr(ps, adv);
 
-	count = init_search(lsb, count, dst, src, SIMD_PRIMETYPE_SAFE);
-	if (!count)
-		return 0;
+#if !defined(NO_SIMD_NARROW8)
+	simd_advance_narrow8(ps, (uint8_t) adv);
+#endif
+	simd_advance_remainders_first(ps, adv);
+}
 
-	scan_twin_or_safeprime(dst, dst);
 
-	while (adv.wr < count) {                // invariant: candidate is 6k+5
-		unsigned int adv1 = 0;
+/*--------------------------------------
+ * phase-1 filter: does the front of the state (8-bit lanes, first 64
+ * primes) indicate a possible prime?
+ */
+static inline
+uint16_t simd_window_nofactor_front(uint16_t tmp[static 64],
+                                    uint16_t tm2[static 64],
+                    const struct PP_Mod16bit *ps)
+{
+#if !defined(NO_SIMD_NARROW8)
+	if (!simd_nofactor8_first((uint8_t *) tmp, ps))
+		return 0;            // small factor among [5..139]
+#endif
 
-		// advance to first index which MAY be a prime based on
-		// first N small primes, or adv is >= 2^14
+	return simd_nofactor_first(tmp, tm2, ps);
+}
 
-			// the first 64 primes, on the average, rule out
-			// approx. 92.7% of all candidates (safe primes)
 
-			// count advances (6*number of elems tested)
-			// up to 2^14 addition total
-			//
-			// this advance can still be added to mod-prime
-			// array elems without generating carries
+#if defined(NO_SIMDDIVIDE_M) && defined(NO_SIMDDIVIDE_L) && \
+    !defined(SIMDPRIME_COUNT_CUSTOM)  //--------------------------------------
+//--------------------------------------
+// note: unlike plain_advance_s(), the state parks at the window
+// boundary past the final survivor, not on the survivor itself; every
+// candidate in between has already been checked, so chained searches
+// continue without duplicates
+//
+static
+SIMD_ISA_CLONES
+uint64_t window_advance_s(uint64_t *lsb, unsigned long count,
+                struct PP_Mod16bit *dst,
+          const struct PP_Mod16bit *src)
+{
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+	uint16_t delta[ SIMD_WINDOW_CANDIDATES ];
+	uint64_t rc;
 
-// TODO: this is essentially simd_no_spfactor_first(); deduplicate
-		while (!(adv1 >> 14) &&
-		       !simd_no_spfactor64x16(adv.tmp, adv.tm2, dst->modn,
-		                           firstprimes_inverse_simd,
-		                           firstprimes_mullimit_simd))
-		{
-// ...first...
-			simd_advance64x16_m2r_inpl(dst->modn, 6,
-			                  firstprimes_mod2range_simd);
-			adv1 += 6;
-		}
+	count = init_search(lsb, count, dst, src, 0);
+	if (!count)
+		return 0;
 
-		state_advance_nr(dst, adv1);
+	adv->wr = plain_advance_to_6kp1(lsb, count, dst, adv);
+	rc     = dst->lsb;
 
-		if (adv1)
-			simd_advance_remainders_rest(dst, adv1);
+	while (adv->wr < count) {            // invariant: candidate is 6k+1
+		uint64_t wbase = dst->lsb;
+		unsigned int c, s, nsurv = 0, skip = 0, done = 0;
 
-		if (adv1 >> 14)
-			continue;
+		for (c=0; c<SIMD_WINDOW_CANDIDATES; ++c) {
+			unsigned int a;
 
-		// advanced first [64] entries; these indicate
-		// no small factor
+			if (simd_window_nofactor_front(adv->tmp, adv->tm2, dst))
+				delta[ nsurv++ ] = (uint16_t) skip;
 
-// TODO: sync simd_no_spfactor_rest1() interface; remove ->modn indirection
+			a = (dst->mod6 == 1) ? 4 : 2;
 
-		if (simd_no_spfactor_rest1(adv.tmp, adv.tm2, dst->modn)) {
-			adv.wr = report_current_lsb(lsb, count, dst->lsb,
-			                            adv.wr);
+			simd_window_advance_front(dst, (uint16_t) a);
+			skip += a;
 		}
 
-		simd_advance_all(dst, 6);
+		for (s=0; s<nsurv; ++s) {       // rest lanes jump survivor
+			if (delta[s] > done) {  // to survivor
+				simd_advance_remainders_rest(dst,
+				                (uint16_t) (delta[s] - done));
+				done = delta[s];
+			}
+
+			if (simd_nofactor_rest_s(adv->tmp, adv->tm2, dst)) {
+				rc     = wbase + delta[s];
+				adv->wr = report_current_lsb(lsb, count,
+				                            rc, adv->wr);
+				if (adv->wr >= count)
+					break;
+			}
+		}
+					// resync rest lanes to window end
+		if (skip > done)
+			simd_advance_remainders_rest(dst,
+			                        (uint16_t) (skip - done));
 	}
 
-	wipe_advance_struct(&adv);
+	advance_scratch_done(adv, &local);
+	wipe(delta, sizeof(delta));
 
-	return dst->lsb;
+	return rc;
 }
-#endif  // !NO_SIMDDIVIDE_S //-----------------------------------------------
+#endif   // NO_SIMDDIVIDE_M && NO_SIMDDIVIDE_L  ------------------------------
 
 
-#if !defined(NO_SIMDDIVIDE_M) //---------------------------------------------
+#if !defined(NO_SIMDDIVIDE_M) && defined(NO_SIMDDIVIDE_L) && \
+    !defined(SIMDPRIME_COUNT_CUSTOM)  //--------------------------------------
 /*--------------------------------------
- * mid-sized equivalent of sfsieve_advance_s
+ * mid-sized prime table, equivalent of window_advance_s()
  */
 static
-uint64_t sfsieve_advance_m(uint64_t *lsb, unsigned long count,
-                 struct PP_Mod16bit *dst,
-           const struct PP_Mod16bit *src)
+SIMD_ISA_CLONES
+uint64_t window_advance_m(uint64_t *lsb, unsigned long count,
+                struct PP_Mod16bit *dst,
+          const struct PP_Mod16bit *src)
 {
-	struct SIMD_Advance adv = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+	uint16_t delta[ SIMD_WINDOW_CANDIDATES ];
+	uint64_t rc;
 
-	count = init_search(lsb, count, dst, src, SIMD_PRIMETYPE_SAFE);
+	count = init_search(lsb, count, dst, src, 0);
 	if (!count)
 		return 0;
 
-	scan_twin_or_safeprime(dst, dst);
-
-	while (adv.wr < count) {                // invariant: candidate is 6k+5
-		unsigned int adv1 = 0;
+	adv->wr = plain_advance_to_6kp1_m(lsb, count, dst, adv);
+	rc     = dst->lsb;
 
-		while (!(adv1 >> 14) &&
-		       !simd_no_spfactor64x16(adv.tmp, adv.tm2, dst->modn,
-		                           firstprimes_inverse_simd,
-		                           firstprimes_mullimit_simd))
-		{
-			simd_advance64x16_m2r_inpl(dst->modn, 6,
-			                  firstprimes_mod2range_simd);
-			adv1 += 6;
-		}
+	while (adv->wr < count) {            // invariant: candidate is 6k+1
+		uint64_t wbase = dst->lsb;
+		unsigned int c, s, nsurv = 0, skip = 0, done = 0;
 
-		state_advance_nr(dst, adv1);
+		for (c=0; c<SIMD_WINDOW_CANDIDATES; ++c) {
+			unsigned int a;
 
-		if (adv1)
-			simd_advance_remainders_rest_m(dst, adv1);
+			if (simd_window_nofactor_front(adv->tmp, adv->tm2, dst))
+				delta[ nsurv++ ] = (uint16_t) skip;
 
-		if (adv1 >> 14)
-			continue;
+			a = (dst->mod6 == 1) ? 4 : 2;
 
-		if (simd_no_spfactor_rest_m(adv.tmp, adv.tm2, dst->modn)) {
-			adv.wr = report_current_lsb(lsb, count, dst->lsb,
-			                            adv.wr);
+			simd_window_advance_front(dst, (uint16_t) a);
+			skip += a;
 		}
 
-		simd_advance_all_m(dst, 6);
+		for (s=0; s<nsurv; ++s) {       // rest lanes jump survivor
+			if (delta[s] > done) {  // to survivor
+				simd_advance_remainders_rest_m(dst,
+				                (uint16_t) (delta[s] - done));
+				done = delta[s];
+			}
+
+			if (simd_nofactor_rest_m(adv->tmp, adv->tm2, dst)) {
+				rc     = wbase + delta[s];
+				adv->wr = report_current_lsb(lsb, count,
+				                            rc, adv->wr);
+				if (adv->wr >= count)
+					break;
+			}
+		}
+					// resync rest lanes to window end
+		if (skip > done)
+			simd_advance_remainders_rest_m(dst,
+			                        (uint16_t) (skip - done));
 	}
 
-	wipe_advance_struct(&adv);
+	advance_scratch_done(adv, &local);
+	wipe(delta, sizeof(delta));
 
-	return dst->lsb;
+	return rc;
 }
-#endif  // !NO_SIMDDIVIDE_M  //----------------------------------------------
+#endif   // !NO_SIMDDIVIDE_M && NO_SIMDDIVIDE_L  -----------------------------
 
 
-#if !defined(NO_SIMDDIVIDE_L)  //--------------------------------------------
+#if !defined(NO_SIMDDIVIDE_L) && \
+    !defined(SIMDPRIME_COUNT_CUSTOM)  //--------------------------------------
 /*--------------------------------------
- * large-table equivalent of sfsieve_advance_s
+ * large prime table, equivalent of window_advance_s()
  */
 static
-uint64_t sfsieve_advance_l(uint64_t *lsb, unsigned long count,
-                  struct PP_Mod16bit *dst,
-            const struct PP_Mod16bit *src)
+SIMD_ISA_CLONES
+uint64_t window_advance_l(uint64_t *lsb, unsigned long count,
+                struct PP_Mod16bit *dst,
+          const struct PP_Mod16bit *src)
 {
-	struct SIMD_Advance adv = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+	uint16_t delta[ SIMD_WINDOW_CANDIDATES ];
+	uint64_t rc;
 
-	count = init_search(lsb, count, dst, src, SIMD_PRIMETYPE_SAFE);
+	count = init_search(lsb, count, dst, src, 0);
 	if (!count)
 		return 0;
 
-	scan_twin_or_safeprime(dst, dst);
-
-	while (adv.wr < count) {                // invariant: candidate is 6k+5
-		unsigned int adv1 = 0;
+	adv->wr = plain_advance_to_6kp1_l(lsb, count, dst, adv);
+	rc     = dst->lsb;
 
-		while (!(adv1 >> 14) &&
-		       !simd_no_spfactor64x16(adv.tmp, adv.tm2, dst->modn,
-		                           firstprimes_inverse_simd,
-		                           firstprimes_mullimit_simd))
-		{
-			simd_advance64x16_m2r_inpl(dst->modn, 6,
-			                  firstprimes_mod2range_simd);
-			adv1 += 6;
-		}
+	while (adv->wr < count) {            // invariant: candidate is 6k+1
+		uint64_t wbase = dst->lsb;
+		unsigned int c, s, nsurv = 0, skip = 0, done = 0;
 
-		state_advance_nr(dst, adv1);
+		for (c=0; c<SIMD_WINDOW_CANDIDATES; ++c) {
+			unsigned int a;
 
-		if (adv1)
-			simd_advance_remainders_rest_l(dst, adv1);
+			if (simd_window_nofactor_front(adv->tmp, adv->tm2, dst))
+				delta[ nsurv++ ] = (uint16_t) skip;
 
-		if (adv1 >> 14)
-			continue;
+			a = (dst->mod6 == 1) ? 4 : 2;
 
-		if (simd_no_spfactor_rest_l(adv.tmp, adv.tm2, dst->modn)) {
-			adv.wr = report_current_lsb(lsb, count, dst->lsb,
-			                            adv.wr);
+			simd_window_advance_front(dst, (uint16_t) a);
+			skip += a;
 		}
 
-		simd_advance_all_l(dst, 6);
+		for (s=0; s<nsurv; ++s) {       // rest lanes jump survivor
+			if (delta[s] > done) {  // to survivor
+				simd_advance_remainders_rest_l(dst,
+				                (uint16_t) (delta[s] - done));
+				done = delta[s];
+			}
+
+			if (simd_nofactor_rest_l(adv->tmp, adv->tm2, dst)) {
+				rc     = wbase + delta[s];
+				adv->wr = report_current_lsb(lsb, count,
+				                            rc, adv->wr);
+				if (adv->wr >= count)
+					break;
+			}
+		}
+					// resync rest lanes to window end
+		if (skip > done)
+			simd_advance_remainders_rest_l(dst,
+			                        (uint16_t) (skip - done));
 	}
 
-	wipe_advance_struct(&adv);
+	advance_scratch_done(adv, &local);
+	wipe(delta, sizeof(delta));
 
-	return dst->lsb;
+	return rc;
 }
-#endif  // !NO_SIMDDIVIDE_L  //----------------------------------------------
+#endif   // !NO_SIMDDIVIDE_L  -----------------------------------------------
 
 
-//--------------------------------------
-uint64_t sfsieve_advance(uint64_t *lsb, unsigned long count,
-               struct PP_Mod16bit *dst,
-         const struct PP_Mod16bit *src)
+#if defined(SIMDPRIME_COUNT_CUSTOM)  //---------------------------------------
+/*--------------------------------------
+ * generated-size equivalent of window_advance_s()
+ */
+static
+SIMD_ISA_CLONES
+uint64_t window_advance_c(uint64_t *lsb, unsigned long count,
+                struct PP_Mod16bit *dst,
+          const struct PP_Mod16bit *src)
 {
-	switch (src ? (src->mode & SIMD_SEARCHTABLE_MASK) : 0) {
-#if !defined(NO_SIMDDIVIDE_L)
-	case SIMD_SEARCHTABLE_L:
-		return sfsieve_advance_l(lsb, count, dst, src);
-#endif
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+	uint16_t delta[ SIMD_WINDOW_CANDIDATES ];
+	uint64_t rc;
 
-#if !defined(NO_SIMDDIVIDE_M)
-	case SIMD_SEARCHTABLE_M:
-		return sfsieve_advance_m(lsb, count, dst, src);
-#endif
+	count = init_search(lsb, count, dst, src, 0);
+	if (!count)
+		return 0;
 
-#if !defined(NO_SIMDDIVIDE_S)
-	case SIMD_SEARCHTABLE_S:
-		return sfsieve_advance_s(lsb, count, dst, src);
-#endif
+	adv->wr = plain_advance_to_6kp1_c(lsb, count, dst, adv);
+	rc     = dst->lsb;
 
-	default:
-		return 0;
+	while (adv->wr < count) {            // invariant: candidate is 6k+1
+		uint64_t wbase = dst->lsb;
+		unsigned int c, s, nsurv = 0, skip = 0, done = 0;
+
+		for (c=0; c<SIMD_WINDOW_CANDIDATES; ++c) {
+			unsigned int a;
+
+			if (simd_window_nofactor_front(adv->tmp, adv->tm2, dst))
+				delta[ nsurv++ ] = (uint16_t) skip;
+
+			a = (dst->mod6 == 1) ? 4 : 2;
+
+			simd_window_advance_front(dst, (uint16_t) a);
+			skip += a;
+		}
+
+		for (s=0; s<nsurv; ++s) {       // rest lanes jump survivor
+			if (delta[s] > done) {  // to survivor
+				simd_advance_remainders_rest_c(dst,
+				                (uint16_t) (delta[s] - done));
+				done = delta[s];
+			}
+
+			if (simd_nofactor_rest_c(adv->tmp, adv->tm2, dst)) {
+				rc     = wbase + delta[s];
+				adv->wr = report_current_lsb(lsb, count,
+				                            rc, adv->wr);
+				if (adv->wr >= count)
+					break;
+			}
+		}
+					// resync rest lanes to window end
+		if (skip > done)
+			simd_advance_remainders_rest_c(dst,
+			                        (uint16_t) (skip - done));
 	}
-}
-#endif   //-----  !NO_SIMD_SAFEPRIME)  ---------------------------------------
 
+	advance_scratch_done(adv, &local);
+	wipe(delta, sizeof(delta));
+
+	return rc;
+}
+#endif   // SIMDPRIME_COUNT_CUSTOM  ------------------------------------------
 
-#if 1  //=====  delimiter: standalone test code  =============================
-#define USE_OPENSSL   /* check conditionals below; add other CSPs if needed */
 
 /*--------------------------------------
- * returns number of mode-specifying bits at start of 'base'
- * sets ps->mode if recognized
- *
- * pass through any unrecognized setting, let subsequent checks detect them
+ * wrapper picking widest _advance() function
  */
-static size_t callmode(struct PP_Mod16bit *ps, const char *base)
+static inline
+uint64_t window_advance(uint64_t *lsb, unsigned long count,
+              struct PP_Mod16bit *dst,
+        const struct PP_Mod16bit *src)
 {
-	size_t skip = 0;
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+	return window_advance_c(lsb, count, dst, src);
 
-	if (base) {
-		int scolon_2nd = (base[0] != '\0') && (base[1] == ':');
-		unsigned int mode = PP_MOD16_INVD_MODE;
+#elif !defined(NO_SIMDDIVIDE_L)
+	return window_advance_l(lsb, count, dst, src);
 
-		switch (base[0]) {
-// TODO: constants
-		case 't':
-		case 'T':
-			mode = scolon_2nd
-			       ? SIMD_PRIMETYPE_TWIN
-			       : PP_MOD16_INVD_MODE;
-			skip = 2;
-			break;
-		case 's':
-		case 'S':
-			mode = scolon_2nd
-			       ? SIMD_PRIMETYPE_SAFE
-			       : PP_MOD16_INVD_MODE;
-			skip = 2;
-			break;
-#if 0
-		case 'f':
-		case 'F':
-			mode = scolon_2nd
-			       ? SIMD_PRIMETYPE_FIPS186
-			       : PP_MOD16_INVD_MODE;
-			skip = 2;
-			break;
-#endif
+#elif !defined(NO_SIMDDIVIDE_M)
+	return window_advance_m(lsb, count, dst, src);
 
-// TODO: non-default prefix for plain-prime search?
-		default:
-			mode = SIMD_PRIMETYPE_PLAIN;
-			break;
-		}
+#else
+	return window_advance_s(lsb, count, dst, src);
+#endif
+}
+#endif  //-----  !NO_SIMD_WINDOWED  ------------------------------------------
 
-		if (ps)
-			ps->mode = mode;
-	}
 
-	return skip;
-}
+#if !defined(NO_SIMD_BITMAP) && \
+    !defined(SIMD_BENCH)      //-----  bitmap survivor output  ----------------
+// alternative output format for distributed scans: one bit per 6k+-1
+// candidate, relative to the scan start, instead of a full uint64_t
+// LSB slice per survivor -- a 384x bandwidth reduction when shipping
+// shard results over a network
+//
+// absolute values are reconstructible from the header: candidate bit b
+// sits at (head.lsb + candidate-stream advance of b steps); the stream
+// alternates +4/+2 from the recorded mod-6 phase
+
+struct SIMD_BitmapHead {
+	uint64_t lsb;            // least-significant u64, candidate of bit 0
+	uint64_t offset;         // candidate of bit 0, rel. offset since init
+	uint64_t bits;           // candidate slots scanned
+	uint32_t mod6;           // mod-6 phase of bit 0 (1 or 5)
+} ;
+//
+#define SIMD_BITMAPHEAD_INIT0  { 0, 0, 0, 0, }
 
 
 /*--------------------------------------
- * calculate (nr) mod mods[] to res[]; (nr) imported from hex string
- * other than avoiding division-by-zero, no sanity checking on modulus list
- *
- * opportunistically sets (nu64, u64s) to big-endian u64[] of (nr,nbytes),
- * if result fits. otherwise, non-NULL array is set to all-0.
+ * scan 'bits' consecutive 6k+-1 candidates; set bit b of map[]
+ * (LSB-first within bytes) if candidate b survives the full table
  *
- * processes chunks in 2^48 units, so all operations require carry-less
- * u64 primitives only
+ * fills *head, if non-NULL, describing candidate bit 0
  *
- * there is an upper limit on input size
- * efficiency is irrelevant
+ * returns least-significant u64 one candidate past the scanned range
+ *         0  if input is invalid
  */
-static int mod16bits(uint16_t *res,
-                     uint64_t *nu64, unsigned int u64s,
-          const unsigned char *nr,     size_t nbytes,
-               const uint16_t *mods,   size_t mcount)
+static
+SIMD_ISA_CLONES
+SIMD_OPTIONAL_FN
+uint64_t bitmap_advance(uint8_t *map, uint64_t bits,
+             struct SIMD_BitmapHead *head,
+             struct PP_Mod16bit *dst,
+       const struct PP_Mod16bit *src)
 {
-	uint64_t n[ PP_MAX_NR_BITS / 64 ] = { 0, };
-	unsigned int m, nrd = 0;
-
-	if (!res || !nr || !nbytes || (nbytes > ((PP_MAX_NR_BITS +7) /8)) ||
-	    !mods || !mcount || (mcount > SIMDPRIME_COUNT))
-		return -1;
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+	uint64_t b;
 
-	if (nu64 && u64s)
-		memset(nu64, 0, u64s*sizeof(uint64_t));
+	if (!map || !bits || !init_search(NULL, 1, dst, src, 0))
+		return 0;
 
-	nrd = bin2u64(n, ARRAY_ELEMS(n), nr, nbytes);
-	if (nrd > ARRAY_ELEMS(n))
-		return -2;
+	memset(map, 0, (size_t) ((bits +7) /8));
 
-	if (nu64 && (nrd <= u64s)) {
-		for (m=0; m<nrd; ++m)
-			nu64[m] = n[m];
+	if (head) {
+		head->lsb    = dst->lsb;
+		head->offset = dst->offset;
+		head->bits   = bits;
+		head->mod6   = dst->mod6;
 	}
 
-	for (m=0; m<mcount; ++m) {
-		if (!mods[m])
-			return -3;
+	for (b=0; b<bits; ++b) {
+		if (simd_has_no_factor_w(adv->tmp, adv->tm2, dst))
+			map[ b >> 3 ] |= (uint8_t) (1 << (b & 7));
 
-		res[m] = modn16(n, nrd, mods[m]);
+		simd_advance_all(dst, (dst->mod6 == 1) ? 4 : 2);
 	}
 
-	return nrd;
+	advance_scratch_done(adv, &local);
+
+	return dst->lsb;
 }
+#endif  //-----  !NO_SIMD_BITMAP  --------------------------------------------
 
 
-//--------------------------------------
-// 'base' read into ps->modn[]
-// 'addl' read into ps->incr[] if non-NULL
-// sets ps->mode to indicate search type
+#if !defined(NO_SIMD_SOA4) && \
+    !defined(SIMD_BENCH)      //-----  interleaved x4 engine  -----------------
+// four independent plain searches in structure-of-arrays layout: the
+// group loops walk all streams for one prime group before moving on,
+// so per-group constants (inverse, limit, mod2range) are loaded once
+// and amortized across the streams -- RSA keygen's p and q, or four
+// shards, advance in one pass over the prime table
 //
-static int mod16read(struct PP_Mod16bit *ps, const char *base,
-                                             const char *addl)
-{
-	unsigned char raw[ PP_MAX_NR_BITS /8 ] = { 0, };
-	size_t rd, hexb;
-
-	if (!ps || !base)
-		return -1;
+// survivor streams are bit-identical to running plain_advance() four
+// times; only the table walk is shared
 
-	*ps = (struct PP_Mod16bit) PP_MOD16BIT_INIT0;
+#define  SIMD_SOA_STREAMS  ((unsigned int) 4)
 
-	rd = callmode(ps, base);
-	if (ps->mode == PP_MOD16_INVD_MODE)
-		return cu_reportrc("unsupported search/mode", -1);
+struct PP_Mod16bitX4 {
+	SIMD_ALIGN
+	uint16_t modn[ SIMD_SOA_STREAMS ][ SIMDPRIME_COUNT ];
 
-	base += rd + hexprefix_advance(base +rd);
-	hexb =  strlen(base);
+	uint64_t lsb   [ SIMD_SOA_STREAMS ];
+	uint64_t offset[ SIMD_SOA_STREAMS ];
 
-	if (hexb > sizeof(ps->qstr))
-		return cu_reportrc("hex/value out of range", -1);
+	unsigned int mod6[ SIMD_SOA_STREAMS ];
 
-	rd = cu_hex2bin(raw, ARRAY_ELEMS(raw), base, hexb);
-	if (rd > ARRAY_ELEMS(raw))
-		return cu_reportrc("hex/value bitcount range", -1);
+	unsigned int mode;             // shared by all streams; only plain
+	                               // searches, see soa4_gather()
+} ;
 
-	memcpy(ps->qstr, base, hexb);
 
-	{
-	uint64_t ndigits[ (PP_MAX_NR_BITS +63) /64 ];          // scratch u64[]
-	int nrd;
+/*--------------------------------------
+ * per-stream survivor-output slice; see soa4_plain_advance()
+ */
+struct SIMD_SoAOut {
+	uint64_t *lsb;
+	unsigned long count;
+	unsigned long wr;
+} ;
 
-	nrd = mod16bits(ps->modn, ndigits, ARRAY_ELEMS(ndigits), raw, rd,
-	                firstprimes, SIMDPRIME_COUNT);
-	if (nrd < 0)
-		return -1;
 
-	ps->mod6 = modn16(ndigits, nrd, 6);
-	ps->lsb  = ndigits[ nrd -1 ];
+/*--------------------------------------
+ * gather four scalar states into interleaved form
+ *
+ * streams must be plain searches without increments, sharing table-size
+ * mode bits; anything else stays with the single-stream drivers
+ *
+ * returns >0 if successful, <0 otherwise
+ */
+static SIMD_OPTIONAL_FN int soa4_gather(struct PP_Mod16bitX4 *x,
+           const struct PP_Mod16bit *src[static SIMD_SOA_STREAMS])
+{
+	unsigned int s;
 
-	if (addl) {
-		addl += hexprefix_advance(addl);
+	if (!x || !src)
+		return -1;
 
-		rd = cu_hex2bin(raw, ARRAY_ELEMS(raw), addl, 0);
-		if (rd > ARRAY_ELEMS(raw))
+	for (s=0; s<SIMD_SOA_STREAMS; ++s) {
+		if (!src[s] ||
+		    ((src[s]->mode & SIMD_PRIMETYPE_MASK) !=
+		     SIMD_PRIMETYPE_PLAIN) ||
+		    (src[s]->mode & SIMD_FIELDSET_INCR) ||
+		    (src[s]->mode != src[0]->mode))
 			return -1;
+	}
 
-		nrd = mod16bits(ps->incr, ndigits, ARRAY_ELEMS(ndigits),
-		                raw, rd, firstprimes, SIMDPRIME_COUNT);
-		if (nrd < 1)
-			return -1;
-		ps->iused = 666;       // TODO: real nr
-// TODO: proper list of failure scenarios -> reportrc() markers
+	memset(x, 0, sizeof(*x));
+	x->mode = src[0]->mode;
 
-		ps->mod6incr = modn16(ndigits, nrd, 6);
+	for (s=0; s<SIMD_SOA_STREAMS; ++s) {
+		memcpy(x->modn[s], src[s]->modn, sizeof(x->modn[s]));
 
-		ps->lsbi =  ndigits[ nrd -1 ];
-		ps->mode |= SIMD_FIELDSET_INCR;
-	}
+		x->lsb[s]    = src[s]->lsb;
+		x->offset[s] = src[s]->offset;
+		x->mod6[s]   = src[s]->mod6;
 	}
 
 	return 1;
 }
 
 
-//--------------------------------------
-static void set_default_table_size(struct PP_Mod16bit *ps)
+/*--------------------------------------
+ * scatter stream 's' back to scalar form, so scans continue through
+ * the single-stream drivers
+ *
+ * returns >0 if successful, <0 otherwise
+ */
+static SIMD_OPTIONAL_FN int soa4_scatter(struct PP_Mod16bit *dst,
+            const struct PP_Mod16bitX4 *x, unsigned int s)
 {
-	if (ps) {
-		ps->mode &= ~SIMD_SEARCHTABLE_MASK;
+	if (!dst || !x || (s >= SIMD_SOA_STREAMS))
+		return -1;
 
-#if !defined(NO_SIMDDIVIDE_L)
-		ps->mode |= SIMD_SEARCHTABLE_L;
-#elif !defined(NO_SIMDDIVIDE_M)
-		ps->mode |= SIMD_SEARCHTABLE_M;
-#else
-		ps->mode |= SIMD_SEARCHTABLE_S;
+	*dst = (struct PP_Mod16bit) PP_MOD16BIT_INIT0;
+
+	memcpy(dst->modn, x->modn[s], sizeof(dst->modn));
+
+	dst->lsb    = x->lsb[s];
+	dst->offset = x->offset[s];
+	dst->mod6   = x->mod6[s];
+	dst->mode   = x->mode;
+
+#if !defined(NO_SIMD_NARROW8)
+	simd_narrow8_refresh(dst);
 #endif
-	}
-}
 
+	return 1;
+}
 
 
 /*--------------------------------------
- * opportunistic: possibly select nondefault prime count
- * returns >0  if ps->mode has been modified
- *         0   nothing to update
- *         <0  unsupported inputs
+ * modn[s][] += adv[s], group-major; adv[s] of 0 freezes a stream
+ * (the m2range pass is a no-op on at-rest lanes)
+ */
+static inline
+void soa4_advance_all(struct PP_Mod16bitX4 *x,
+          const uint16_t adv[static SIMD_SOA_STREAMS],
+                unsigned int lanes)
+{
+	unsigned int g, s;
+
+	for (g=0; g<lanes; g+=16) {
+		for (s=0; s<SIMD_SOA_STREAMS; ++s) {
+			simd_advance16x16_inpl(&(x->modn[s][g]), adv[s]);
+			simd_m2range16x16_inpl(&(x->modn[s][g]),
+			          &(firstprimes_mod2range_simd[g]));
+		}
+	}
+
+	for (s=0; s<SIMD_SOA_STREAMS; ++s) {
+		x->lsb[s]    += adv[s];
+		x->offset[s] += adv[s];
+		x->mod6[s]   =  (x->mod6[s] + (adv[s] % 6)) % 6;
+	}
+}
+
+
+/*--------------------------------------
+ * alive-masked joint check over lane range [from, to): clears the bit
+ * of any stream picking up a factor; group-major, so each group's
+ * constants are fetched once for all surviving streams
+ */
+static inline
+unsigned int soa4_nofactor_range(uint16_t tmp[static 64],
+                                 uint16_t tm2[static 64],
+                 const struct PP_Mod16bitX4 *x,
+                         unsigned int from, unsigned int to,
+                         unsigned int alive)
+{
+	unsigned int g, s;
+
+	for (g=from; (g<to) && alive; g+=64) {
+		for (s=0; s<SIMD_SOA_STREAMS; ++s) {
+			if (!(alive & (1u << s)))
+				continue;
+
+			if (!simd_nofactor64x16(tmp, tm2, &(x->modn[s][g]),
+			          &(firstprimes_inverse_simd[g]),
+			         &(firstprimes_mullimit_simd[g])))
+				alive &= ~(1u << s);
+		}
+	}
+
+	return alive;
+}
+
+
+/*--------------------------------------
+ * interleaved plain search: fill each stream's output slice, walking
+ * the prime table once per candidate step for all streams
+ *
+ * each stream parks on its final survivor, as plain_advance() does;
+ * filled streams freeze while the rest continue
+ *
+ * returns last lsb64 of stream 0; 0 if inputs are unusable
+ */
+static
+SIMD_ISA_CLONES
+SIMD_OPTIONAL_FN
+uint64_t soa4_plain_advance(struct SIMD_SoAOut out[static SIMD_SOA_STREAMS],
+                  struct PP_Mod16bitX4 *x)
+{
+	SIMD_ALIGN uint16_t tmp[ 64 ];
+	SIMD_ALIGN uint16_t tm2[ 64 ];
+	uint16_t adv[ SIMD_SOA_STREAMS ];
+	unsigned int s, pending = 0, lanes, r2from, r2to;
+
+	if (!out || !x)
+		return 0;
+
+			// second check range matches the scalar
+			// simd_has_no_factor() chain of the table size
+	switch (x->mode & SIMD_SEARCHTABLE_MASK) {
+#if !defined(NO_SIMDDIVIDE_S)
+	case SIMD_SEARCHTABLE_S:
+		lanes = 576;   r2from = 64;    r2to = 576;
+		break;
+#endif
+
+#if !defined(NO_SIMDDIVIDE_M)
+	case SIMD_SEARCHTABLE_M:
+		lanes = 1856;  r2from = 576;   r2to = 1856;
+		break;
+#endif
+
+#if !defined(NO_SIMDDIVIDE_L)
+	case SIMD_SEARCHTABLE_L:
+		lanes = 3456;  r2from = 1856;  r2to = 3456;
+		break;
+#endif
+
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+	case SIMD_SEARCHTABLE_C:
+		lanes  = SIMDPRIME_COUNT_CUSTOM;
+		r2from = 64;
+		r2to   = SIMDPRIME_COUNT_CUSTOM;
+		break;
+#endif
+
+	default:
+		return 0;
+	}
+
+	for (s=0; s<SIMD_SOA_STREAMS; ++s) {
+		if (out[s].lsb && out[s].count && (out[s].wr < out[s].count))
+			pending |= 1u << s;
+
+		adv[s] = (uint16_t) prime_mod6_advance(x->mod6[s]);
+	}
+
+	soa4_advance_all(x, adv, lanes);           // align to 6k+-1 start
+
+	while (pending) {
+		unsigned int nof;
+
+		nof = soa4_nofactor_range(tmp, tm2, x,      0,   64, pending);
+		nof = soa4_nofactor_range(tmp, tm2, x, r2from, r2to, nof);
+
+		for (s=0; s<SIMD_SOA_STREAMS; ++s) {
+			if (!(nof & (1u << s)))
+				continue;
+
+			out[s].wr = report_current_lsb(out[s].lsb,
+			                               out[s].count,
+			                               x->lsb[s], out[s].wr);
+			if (out[s].wr >= out[s].count)
+				pending &= ~(1u << s);
+		}
+
+		for (s=0; s<SIMD_SOA_STREAMS; ++s) {
+			adv[s] = (pending & (1u << s))
+			         ? ((x->mod6[s] == 1) ? 4 : 2) : 0;
+		}
+
+		soa4_advance_all(x, adv, lanes);
+	}
+
+	wipe(tmp, sizeof(tmp));
+	wipe(tm2, sizeof(tm2));
+
+	return x->lsb[0];
+}
+#endif  //-----  !NO_SIMD_SOA4  ----------------------------------------------
+
+
+#if !defined(NO_SIMD_AUTOTUNE) && \
+    !defined(SIMD_BENCH)      //-----  adaptive table depth  ------------------
+// picks an effective trial-division depth at runtime, balancing the
+// measured cost of one more 64-prime rest group against the
+// caller-supplied cost of one surviving candidate's downstream test
+// (modexp, MR round etc.).  a group's marginal rejection rate,
+// 1 - prod(1 - 1/p), only shrinks with depth, so the first group that
+// does not pay for itself ends the scan
+//
+// the tuned driver advances only the selected lanes: lanes past the
+// cutoff go stale, so a tuned state must be re-derived before handing
+// it to the fixed-depth engines
+
+#include <time.h>
+
+#define  SIMD_TUNE_LOOPS  ((unsigned int) 4096)
+
+		// deepest maintained depth: generated builds advance
+		// fewer lanes than the backing tables hold
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+#define  SIMD_TUNE_MAX_LANES  SIMDPRIME_COUNT_CUSTOM
+#else
+#define  SIMD_TUNE_MAX_LANES  SIMDPRIME_COUNT
+#endif
+
+/*--------------------------------------
+ * runtime-bounded version of simd_nofactor_rest_s(): checks primes
+ * [64, lanes); 'lanes' must be a multiple of 64
+ *
+ * groups are visited in tabulated marginal-rejection order, so the
+ * early exit fires after the fewest 64-byte blocks on average; the
+ * front group and anything at or past the depth cutoff are skipped
+ */
+static inline
+uint16_t simd_nofactor_rest_r(uint16_t tmp[static 64],
+                              uint16_t tm2[static 64],
+              const struct PP_Mod16bit *ps, unsigned int lanes)
+{
+	unsigned int gi, g;
+
+	for (gi=0; gi<ARRAY_ELEMS(firstprimes_grouporder_simd); ++gi) {
+		g = firstprimes_grouporder_simd[ gi ];
+
+		if ((g < 64) || (g >= lanes))
+			continue;
+
+		if (!simd_nofactor64x16(tmp, tm2, &(ps->modn[ g ]),
+		                  &(firstprimes_inverse_simd[ g ]),
+		                 &(firstprimes_mullimit_simd[ g ])))
+			return 0;
+	}
+
+	return 1;
+}
+
+
+/*--------------------------------------
+ * runtime-bounded version of simd_advance_all()
+ */
+static inline
+void simd_advance_all_r(struct PP_Mod16bit *ps, uint16_t adv,
+                              unsigned int lanes)
+{
+	unsigned int g;
+
+	state_advance_nr(ps, adv);
+
+#if !defined(NO_SIMD_NARROW8)
+	simd_advance_narrow8(ps, (uint8_t) adv);
+#endif
+	simd_advance_remainders_first(ps, adv);
+
+	for (g=64; g<lanes; g+=64) {
+		simd_advance64x16_m2r_inpl(&(ps->modn[ g ]), adv,
+		          &(firstprimes_mod2range_simd[ g ]));
+	}
+}
+
+
+/*--------------------------------------
+ * depth-bounded equivalent of simd_check_plain1()
+ */
+static inline
+unsigned long simd_check_plain1_r(uint64_t *lsb, unsigned long count,
+                             unsigned long wr,
+                                  uint16_t tmp[static 64],
+                                  uint16_t tm2[static 64],
+                  const struct PP_Mod16bit *ps, unsigned int lanes)
+{
+#if !defined(NO_SIMD_NARROW8)
+	if (!simd_nofactor8_first((uint8_t *) tmp, ps))
+		return wr;           // small factor among [5..139]
+#endif
+
+	if (simd_nofactor_first(tmp, tm2, ps) &&
+	    simd_nofactor_rest_r(tmp, tm2, ps, lanes))
+		wr = report_current_lsb(lsb, count, ps->lsb, wr);
+
+	return wr;
+}
+
+
+/*--------------------------------------
+ * measured cost, in ns, of checking one 64-prime rest group of 'ps'
+ */
+static double simd_tune_groupcost(const struct PP_Mod16bit *ps)
+{
+	SIMD_ALIGN uint16_t tmp[ 64 ];
+	SIMD_ALIGN uint16_t tm2[ 64 ];
+	struct timespec t0, t1;
+	volatile uint16_t keep;
+	uint16_t acc = 0;
+	unsigned int i, g;
+	double ns;
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t0);
+
+	for (i=0; i<SIMD_TUNE_LOOPS; ++i) {
+		for (g=64; g<576; g+=64) {
+			acc ^= simd_nofactor64x16(tmp, tm2,
+			                            &(ps->modn[ g ]),
+			           &(firstprimes_inverse_simd[ g ]),
+			          &(firstprimes_mullimit_simd[ g ]));
+		}
+	}
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t1);
+
+	keep = acc;                  // keep the kernel results observable
+	(void) keep;
+
+	ns = (double) (t1.tv_sec  - t0.tv_sec) * 1e9 +
+	     (double) (t1.tv_nsec - t0.tv_nsec);
+
+	wipe(tmp, sizeof(tmp));
+	wipe(tm2, sizeof(tm2));
+
+	return ns / ((double) SIMD_TUNE_LOOPS * 8.0);
+}
+
+
+/*--------------------------------------
+ * effective depth for 'survivor_ns', the downstream cost in ns of one
+ * candidate surviving trial division
+ *
+ * returns a lane count in [64, SIMD_TUNE_MAX_LANES], multiple of 64
+ */
+static SIMD_OPTIONAL_FN
+unsigned int simd_tune_depth(const struct PP_Mod16bit *ps,
+                                      double survivor_ns)
+{
+	double group_ns = simd_tune_groupcost(ps);
+	unsigned int g, i, lanes = 64;
+
+	for (g=64; g<SIMD_TUNE_MAX_LANES; g+=64) {
+		double pass = 1.0;
+
+		for (i=g; i<g+64; ++i)
+			pass *= 1.0 - 1.0 / (double) firstprimes[i];
+
+		if (group_ns >= survivor_ns * (1.0 - pass))
+			break;
+
+		lanes = g + 64;
+	}
+
+	return lanes;
+}
+
+
+/*--------------------------------------
+ * depth-bounded form of plain_advance_to_6kp1(); see there
+ */
+static inline
+unsigned long plain_advance_to_6kp1_r(uint64_t *lsb, unsigned long count,
+                            struct PP_Mod16bit *ps,
+	                   struct SIMD_Advance *adv,
+                                unsigned int lanes)
+{
+	if (ps && adv && (ps->mod6 == 5)) {         // advance 6k+5 -> 6(k+1)+1
+		adv->wr = simd_check_plain1_r(lsb, count, adv->wr,
+		                             adv->tmp, adv->tm2, ps, lanes);
+
+		simd_advance_all_r(ps, 2, lanes);
+	}
+
+	return adv ? adv->wr : 0;
+}
+
+
+/*--------------------------------------
+ * plain search checking and advancing only the first 'lanes' primes;
+ * see simd_tune_depth() for picking 'lanes'
+ *
+ * NOTE: lanes past the cutoff are stale once this returns
+ */
+static
+SIMD_ISA_CLONES
+SIMD_OPTIONAL_FN
+uint64_t tuned_advance(uint64_t *lsb, unsigned long count,
+             struct PP_Mod16bit *dst,
+       const struct PP_Mod16bit *src,
+             unsigned int lanes)
+{
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+
+	lanes -= lanes % 64;
+	if (lanes < 64)
+		lanes = 64;
+	if (lanes > SIMD_TUNE_MAX_LANES)
+		lanes = SIMD_TUNE_MAX_LANES;
+
+	count = init_search(lsb, count, dst, src, 0);
+	if (!count)
+		return 0;
+
+	adv->wr = plain_advance_to_6kp1_r(lsb, count, dst, adv, lanes);
+
+	while ((adv->wr < count) &&
+	       scan_budget_ok(2)) {     // invariant: candidate is 6k+1
+		adv->wr = simd_check_plain1_r(lsb, count, adv->wr,
+		                             adv->tmp, adv->tm2, dst, lanes);
+
+		if (adv->wr < count) {
+			simd_advance_all_r(dst, 4, lanes);      // 6k+1 -> 6k+5
+
+			adv->wr = simd_check_plain1_r(lsb, count, adv->wr,
+			                             adv->tmp, adv->tm2, dst,
+			                             lanes);
+			if (adv->wr < count)                 // 6k+5 -> 6(k+1)+1
+				simd_advance_all_r(dst, 2, lanes);
+		}
+	}
+
+	advance_scratch_done(adv, &local);
+
+	return dst->lsb;
+}
+#endif  //-----  !NO_SIMD_AUTOTUNE  ------------------------------------------
+#endif  //-----  !NO_SIMD_PLAINPRIME  ----------------------------------------
+
+
+#if !defined(NO_SIMD_TWINPRIME) && !defined(NO_SIMD_SAFEPRIME)  //------------
+// shared code: twin primes, safe primes
+
+//--------------------------------------
+// both safe prime and twin-prime search is restricted to p=6k+5
+// advance to potential start position
+//
+static void scan_twin_or_safeprime(struct PP_Mod16bit *dst,
+                             const struct PP_Mod16bit *src)
+{
+	if (dst) {
+		uint16_t adv;
+
+		scan_inherit_or0(dst, src);
+
+		adv = (11 - dst->mod6) % 6;                  // advance to 6k+5
+
+		simd_advance_all(dst, adv);
+	}
+}
+#endif   //-----  !NO_SIMD_TWINPRIME && !NO_SIMD_SAFEPRIME  ------------------
+
+
+#if !defined(NO_SIMD_TWINPRIME)  //---- twin prime: u and (u + 2) primes -----
+// scanning primes of form 6k+5, for 'twin primes' where 6k+7 may also
+// be a prime
+
+#if defined(NO_SIMDDIVIDE_M) && defined(NO_SIMDDIVIDE_L) && \
+    !defined(SIMDPRIME_COUNT_CUSTOM)  //--------------------------------------
+// small prime-table
+//
+static
+SIMD_ISA_CLONES
+uint64_t twin_advance_s(uint64_t *lsb, unsigned long count,
+              struct PP_Mod16bit *dst,
+        const struct PP_Mod16bit *src)
+{
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+
+	count = init_search(lsb, count, dst, src, SIMD_PRIMETYPE_TWIN);
+	if (!count)
+		return 0;
+
+	for (adv->wr=0; (adv->wr < count) && scan_budget_ok(1); ) {
+		unsigned int skip = 0;
+
+		// advance to first index which MAY be a prime based on
+		// first N small primes, or adv is >= 2^16
+
+		// count advances (6*number of elems tested)
+		// up to 2^15 addition total
+		//
+		// this advance can still be added to mod-prime
+		// array elems without generating carries
+
+		while (!(skip >> 14) &&
+		       !simd_no_twinfactor64x16(adv->tmp, adv->tm2, dst->modn,
+		                                firstprimes_inverse_simd,
+		                                firstprimes_mullimit_simd))
+		{
+			simd_advance64x16_m2r_inpl(dst->modn, 6,
+			                      firstprimes_mod2range_simd);
+			skip += 6;
+		}
+
+		state_advance_nr(dst, skip);
+
+					// only first 64 have been advanced
+					// now advance entries >64,
+		if (skip)
+			simd_advance_remainders_rest(dst, skip);
+
+		if (skip >> 14)
+			continue;
+
+		if (simd_no_twinfactor_rest(adv->tmp, adv->tm2, dst->modn)) {
+			adv->wr = report_current_lsb(lsb, count,
+			                            dst->lsb, adv->wr);
+		}
+
+		simd_advance_all(dst, 6);
+	}
+
+	advance_scratch_done(adv, &local);
+
+	return dst->lsb;
+}
+#endif    // NO_SIMDDIVIDE_M && NO_SIMDDIVIDE_L  ----------------------------
+
+
+#if !defined(NO_SIMDDIVIDE_M) && defined(NO_SIMDDIVIDE_L) && \
+    !defined(SIMDPRIME_COUNT_CUSTOM)  //--------------------------------------
+/*--------------------------------------
+ * mid-sized prime table, equivalent of twin_advance()
+ */
+static
+SIMD_ISA_CLONES
+uint64_t twin_advance_m(uint64_t *lsb, unsigned long count,
+              struct PP_Mod16bit *dst,
+        const struct PP_Mod16bit *src)
+{
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+
+	count = init_search(lsb, count, dst, src, SIMD_PRIMETYPE_TWIN);
+	if (!count)
+		return 0;
+
+	for (adv->wr=0; (adv->wr < count) && scan_budget_ok(1); ) {
+		unsigned int skip = 0;
+
+		// advance to first index which MAY be a prime based on
+		// first N small primes, or adv is >= 2^16
+
+		// count advances (6*number of elems tested)
+		// up to 2^15 addition total
+		//
+		// this advance can still be added to mod-prime
+		// array elems without generating carries
+
+		while (!(skip >> 14) &&
+		       !simd_no_twinfactor64x16(adv->tmp, adv->tm2, dst->modn,
+		                                firstprimes_inverse_simd,
+		                                firstprimes_mullimit_simd))
+		{
+			simd_advance64x16_m2r_inpl(dst->modn, 6,
+			                      firstprimes_mod2range_simd);
+			skip += 6;
+		}
+
+		state_advance_nr(dst, skip);
+
+					// only first 64 have been advanced
+					// now advance entries >64,
+		if (skip)
+			simd_advance_remainders_rest_m(dst, skip);
+
+		if (skip >> 14)
+			continue;
+
+		if (simd_no_twinfactor_rest_m(adv->tmp, adv->tm2, dst->modn)) {
+			adv->wr = report_current_lsb(lsb, count,
+			                            dst->lsb, adv->wr);
+		}
+
+		simd_advance_all(dst, 6);
+	}
+
+	advance_scratch_done(adv, &local);
+
+	return dst->lsb;
+}
+#endif    // !NO_SIMDDIVIDE_M && NO_SIMDDIVIDE_L  ---------------------------
+
+
+#if !defined(NO_SIMDDIVIDE_L) && \
+    !defined(SIMDPRIME_COUNT_CUSTOM)  //--------------------------------------
+/*--------------------------------------
+ * large prime table, equivalent of twin_advance()
+ */
+static
+SIMD_ISA_CLONES
+uint64_t twin_advance_l(uint64_t *lsb, unsigned long count,
+               struct PP_Mod16bit *dst,
+         const struct PP_Mod16bit *src)
+{
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+
+	count = init_search(lsb, count, dst, src, SIMD_PRIMETYPE_TWIN);
+	if (!count)
+		return 0;
+
+	for (adv->wr=0; (adv->wr < count) && scan_budget_ok(1); ) {
+		unsigned int skip = 0;
+
+		// advance to first index which MAY be a prime based on
+		// first N small primes, or adv is >= 2^16
+
+		// count advances (6*number of elems tested)
+		// up to 2^15 addition total
+		//
+		// this advance can still be added to mod-prime
+		// array elems without generating carries
+
+		while (!(skip >> 14) &&
+		       !simd_no_twinfactor64x16(adv->tmp, adv->tm2, dst->modn,
+		                                firstprimes_inverse_simd,
+		                                firstprimes_mullimit_simd))
+		{
+			simd_advance64x16_m2r_inpl(dst->modn, 6,
+			                      firstprimes_mod2range_simd);
+			skip += 6;
+		}
+
+		state_advance_nr(dst, skip);
+
+					// only first 64 have been advanced
+					// now advance entries >64,
+		if (skip)
+			simd_advance_remainders_rest_l(dst, skip);
+
+		if (skip >> 14)
+			continue;
+
+		if (simd_no_twinfactor_rest_l(adv->tmp, adv->tm2, dst->modn)) {
+			adv->wr = report_current_lsb(lsb, count,
+			                            dst->lsb, adv->wr);
+		}
+
+		simd_advance_all(dst, 6);
+	}
+
+	advance_scratch_done(adv, &local);
+
+	return dst->lsb;
+}
+#endif   // !NO_SIMDDIVIDE_L  -----------------------------------------------
+
+
+#if defined(SIMDPRIME_COUNT_CUSTOM)  //---------------------------------------
+/*--------------------------------------
+ * generated-size equivalent of twin_advance()
+ */
+static
+SIMD_ISA_CLONES
+uint64_t twin_advance_c(uint64_t *lsb, unsigned long count,
+              struct PP_Mod16bit *dst,
+        const struct PP_Mod16bit *src)
+{
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+
+	count = init_search(lsb, count, dst, src, SIMD_PRIMETYPE_TWIN);
+	if (!count)
+		return 0;
+
+	for (adv->wr=0; (adv->wr < count) && scan_budget_ok(1); ) {
+		unsigned int skip = 0;
+
+		// advance to first index which MAY be a prime based on
+		// first N small primes, or adv is >= 2^16
+
+		// count advances (6*number of elems tested)
+		// up to 2^15 addition total
+		//
+		// this advance can still be added to mod-prime
+		// array elems without generating carries
+
+		while (!(skip >> 14) &&
+		       !simd_no_twinfactor64x16(adv->tmp, adv->tm2, dst->modn,
+		                                firstprimes_inverse_simd,
+		                                firstprimes_mullimit_simd))
+		{
+			simd_advance64x16_m2r_inpl(dst->modn, 6,
+			                      firstprimes_mod2range_simd);
+			skip += 6;
+		}
+
+		state_advance_nr(dst, skip);
+
+					// only first 64 have been advanced
+					// now advance entries >64,
+		if (skip)
+			simd_advance_remainders_rest_c(dst, skip);
+
+		if (skip >> 14)
+			continue;
+
+		if (simd_no_twinfactor_rest_c(adv->tmp, adv->tm2, dst->modn)) {
+			adv->wr = report_current_lsb(lsb, count,
+			                            dst->lsb, adv->wr);
+		}
+
+		simd_advance_all(dst, 6);
+	}
+
+	advance_scratch_done(adv, &local);
+
+	return dst->lsb;
+}
+#endif   // SIMDPRIME_COUNT_CUSTOM  ------------------------------------------
+
+
+/*--------------------------------------
+ * wrapper picking widest _advance() function
+ */
+static inline
+uint64_t twin_advance_w(uint64_t *lsb, unsigned long count,
+              struct PP_Mod16bit *dst,
+        const struct PP_Mod16bit *src)
+{
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+	return twin_advance_c(lsb, count, dst, src);
+
+#elif !defined(NO_SIMDDIVIDE_L)
+	return twin_advance_l(lsb, count, dst, src);
+
+#elif !defined(NO_SIMDDIVIDE_M)
+	return twin_advance_m(lsb, count, dst, src);
+
+#else
+	return twin_advance_s(lsb, count, dst, src);
+#endif
+}
+#endif   //-----  !NO_SIMD_TWINPRIME)  ---------------------------------------
+
+
+#if !defined(NO_SIMD_SAFEPRIME)  //-------------------------------------------
+
+#if !defined(NO_SIMDDIVIDE_S)  //---------------------------------------------
+/*--------------------------------------
+ * list possible ls64(Q) of values where both Q and 2Q+1 MAY be primes
+ * (have no small factors in our list of small primes)
+ * [main entry point]
+ *
+ * advances from 'src' to 'dst'
+ *
+ * if non-NULL, fill lsb[] with 'count' next lsb64(Q) values,
+ * in increasing order.
+ * NOTE: WE DO NOT TRACK WRAPAROUND AT 2^64 BOUNDARIES.
+ *
+ * NULL 'lsb' returns the next possible lsb64(Q), and advances 'dst'
+ * to next possible candidate.
+ *
+ * returns the last lsb64(Q) enumerated.
+ *
+ * 'src' and 'dst' may be the same struct
+ */
+static
+SIMD_ISA_CLONES
+uint64_t sfsieve_advance_s(uint64_t *lsb, unsigned long count,
+                 struct PP_Mod16bit *dst,
+           const struct PP_Mod16bit *src)
+{
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+
+	count = init_search(lsb, count, dst, src, SIMD_PRIMETYPE_SAFE);
+	if (!count)
+		return 0;
+
+	scan_twin_or_safeprime(dst, dst);
+
+	while ((adv->wr < count) &&
+	       scan_budget_ok(1)) {     // invariant: candidate is 6k+5
+		unsigned int adv1 = 0;
+
+		// advance to first index which MAY be a prime based on
+		// first N small primes, or adv is >= 2^14
+
+			// the first 64 primes, on the average, rule out
+			// approx. 92.7% of all candidates (safe primes)
+
+			// count advances (6*number of elems tested)
+			// up to 2^14 addition total
+			//
+			// this advance can still be added to mod-prime
+			// array elems without generating carries
+
+// TODO: this is essentially simd_no_spfactor_first(); deduplicate
+		while (!(adv1 >> 14) &&
+		       !simd_no_spfactor64x16(adv->tmp, adv->tm2, dst->modn,
+		                           firstprimes_inverse_simd,
+		                           firstprimes_mullimit_simd))
+		{
+// ...first...
+			simd_advance64x16_m2r_inpl(dst->modn, 6,
+			                  firstprimes_mod2range_simd);
+			adv1 += 6;
+		}
+
+		state_advance_nr(dst, adv1);
+
+		if (adv1)
+			simd_advance_remainders_rest(dst, adv1);
+
+		if (adv1 >> 14)
+			continue;
+
+		// advanced first [64] entries; these indicate
+		// no small factor
+
+// TODO: sync simd_no_spfactor_rest1() interface; remove ->modn indirection
+
+		if (simd_no_spfactor_rest1(adv->tmp, adv->tm2, dst->modn)) {
+			adv->wr = report_current_lsb(lsb, count, dst->lsb,
+			                            adv->wr);
+		}
+
+		simd_advance_all(dst, 6);
+	}
+
+	advance_scratch_done(adv, &local);
+
+	return dst->lsb;
+}
+#endif  // !NO_SIMDDIVIDE_S //-----------------------------------------------
+
+
+#if !defined(NO_SIMDDIVIDE_M) //---------------------------------------------
+/*--------------------------------------
+ * mid-sized equivalent of sfsieve_advance_s
+ */
+static
+SIMD_ISA_CLONES
+uint64_t sfsieve_advance_m(uint64_t *lsb, unsigned long count,
+                 struct PP_Mod16bit *dst,
+           const struct PP_Mod16bit *src)
+{
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+
+	count = init_search(lsb, count, dst, src, SIMD_PRIMETYPE_SAFE);
+	if (!count)
+		return 0;
+
+	scan_twin_or_safeprime(dst, dst);
+
+	while ((adv->wr < count) &&
+	       scan_budget_ok(1)) {     // invariant: candidate is 6k+5
+		unsigned int adv1 = 0;
+
+		while (!(adv1 >> 14) &&
+		       !simd_no_spfactor64x16(adv->tmp, adv->tm2, dst->modn,
+		                           firstprimes_inverse_simd,
+		                           firstprimes_mullimit_simd))
+		{
+			simd_advance64x16_m2r_inpl(dst->modn, 6,
+			                  firstprimes_mod2range_simd);
+			adv1 += 6;
+		}
+
+		state_advance_nr(dst, adv1);
+
+		if (adv1)
+			simd_advance_remainders_rest_m(dst, adv1);
+
+		if (adv1 >> 14)
+			continue;
+
+		if (simd_no_spfactor_rest_m(adv->tmp, adv->tm2, dst->modn)) {
+			adv->wr = report_current_lsb(lsb, count, dst->lsb,
+			                            adv->wr);
+		}
+
+		simd_advance_all_m(dst, 6);
+	}
+
+	advance_scratch_done(adv, &local);
+
+	return dst->lsb;
+}
+#endif  // !NO_SIMDDIVIDE_M  //----------------------------------------------
+
+
+#if !defined(NO_SIMDDIVIDE_L)  //--------------------------------------------
+/*--------------------------------------
+ * large-table equivalent of sfsieve_advance_s
+ */
+static
+SIMD_ISA_CLONES
+uint64_t sfsieve_advance_l(uint64_t *lsb, unsigned long count,
+                  struct PP_Mod16bit *dst,
+            const struct PP_Mod16bit *src)
+{
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+
+	count = init_search(lsb, count, dst, src, SIMD_PRIMETYPE_SAFE);
+	if (!count)
+		return 0;
+
+	scan_twin_or_safeprime(dst, dst);
+
+	while ((adv->wr < count) &&
+	       scan_budget_ok(1)) {     // invariant: candidate is 6k+5
+		unsigned int adv1 = 0;
+
+		while (!(adv1 >> 14) &&
+		       !simd_no_spfactor64x16(adv->tmp, adv->tm2, dst->modn,
+		                           firstprimes_inverse_simd,
+		                           firstprimes_mullimit_simd))
+		{
+			simd_advance64x16_m2r_inpl(dst->modn, 6,
+			                  firstprimes_mod2range_simd);
+			adv1 += 6;
+		}
+
+		state_advance_nr(dst, adv1);
+
+		if (adv1)
+			simd_advance_remainders_rest_l(dst, adv1);
+
+		if (adv1 >> 14)
+			continue;
+
+		if (simd_no_spfactor_rest_l(adv->tmp, adv->tm2, dst->modn)) {
+			adv->wr = report_current_lsb(lsb, count, dst->lsb,
+			                            adv->wr);
+		}
+
+		simd_advance_all_l(dst, 6);
+	}
+
+	advance_scratch_done(adv, &local);
+
+	return dst->lsb;
+}
+#endif  // !NO_SIMDDIVIDE_L  //----------------------------------------------
+
+
+#if defined(SIMDPRIME_COUNT_CUSTOM)  //---------------------------------------
+/*--------------------------------------
+ * generated-size equivalent of sfsieve_advance_s
+ */
+static
+SIMD_ISA_CLONES
+uint64_t sfsieve_advance_c(uint64_t *lsb, unsigned long count,
+                  struct PP_Mod16bit *dst,
+            const struct PP_Mod16bit *src)
+{
+	struct SIMD_Advance local = SIMD_ADVANCE_INIT0;
+	struct SIMD_Advance *adv = advance_scratch(&local);
+
+	count = init_search(lsb, count, dst, src, SIMD_PRIMETYPE_SAFE);
+	if (!count)
+		return 0;
+
+	scan_twin_or_safeprime(dst, dst);
+
+	while ((adv->wr < count) &&
+	       scan_budget_ok(1)) {     // invariant: candidate is 6k+5
+		unsigned int adv1 = 0;
+
+		while (!(adv1 >> 14) &&
+		       !simd_no_spfactor64x16(adv->tmp, adv->tm2, dst->modn,
+		                           firstprimes_inverse_simd,
+		                           firstprimes_mullimit_simd))
+		{
+			simd_advance64x16_m2r_inpl(dst->modn, 6,
+			                  firstprimes_mod2range_simd);
+			adv1 += 6;
+		}
+
+		state_advance_nr(dst, adv1);
+
+		if (adv1)
+			simd_advance_remainders_rest_c(dst, adv1);
+
+		if (adv1 >> 14)
+			continue;
+
+		if (simd_no_spfactor_rest_c(adv->tmp, adv->tm2, dst->modn)) {
+			adv->wr = report_current_lsb(lsb, count, dst->lsb,
+			                            adv->wr);
+		}
+
+		simd_advance_all_c(dst, 6);
+	}
+
+	advance_scratch_done(adv, &local);
+
+	return dst->lsb;
+}
+#endif  // SIMDPRIME_COUNT_CUSTOM  //-----------------------------------------
+
+
+//--------------------------------------
+uint64_t sfsieve_advance(uint64_t *lsb, unsigned long count,
+               struct PP_Mod16bit *dst,
+         const struct PP_Mod16bit *src)
+{
+	switch (src ? (src->mode & SIMD_SEARCHTABLE_MASK) : 0) {
+#if !defined(NO_SIMDDIVIDE_L)
+	case SIMD_SEARCHTABLE_L:
+		return sfsieve_advance_l(lsb, count, dst, src);
+#endif
+
+#if !defined(NO_SIMDDIVIDE_M)
+	case SIMD_SEARCHTABLE_M:
+		return sfsieve_advance_m(lsb, count, dst, src);
+#endif
+
+#if !defined(NO_SIMDDIVIDE_S)
+	case SIMD_SEARCHTABLE_S:
+		return sfsieve_advance_s(lsb, count, dst, src);
+#endif
+
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+	case SIMD_SEARCHTABLE_C:
+		return sfsieve_advance_c(lsb, count, dst, src);
+#endif
+
+	default:
+		return 0;
+	}
+}
+#endif   //-----  !NO_SIMD_SAFEPRIME)  ---------------------------------------
+
+
+#if !defined(NO_SIMD_DUALSCAN)  && \
+    !defined(NO_SIMD_TWINPRIME) && \
+    !defined(NO_SIMD_SAFEPRIME) && \
+    !defined(SIMD_BENCH)      //-----  fused twin+safe scan  ------------------
+// research scans wanting twin primes AND safe primes over the same
+// range previously ran two full table passes.  both searches walk the
+// same 6k+5 candidate stream, so the fused form loads each group's
+// remainders once, derives the shared modn[]*1/prime[] products, and
+// evaluates both companion comparisons against them, emitting two
+// survivor streams in one traversal
+
+		// result/request bits of the fused group check
+#define  SIMD_DUAL_TWIN  ((unsigned int) 1)     /* u, u+2  have no factor */
+#define  SIMD_DUAL_SAFE  ((unsigned int) 2)     /* u, 2u+1 have no factor */
+
+/*--------------------------------------
+ * joint check of one 64-lane group: which of the requested ('want')
+ * companion conditions stay viable?
+ *
+ * u[] holds the shared products; rt[]/rs[] collect the twin and
+ * safe-prime masks; tm2[] is reduction scratch.  all four are filled
+ * with (potentially)secret-dependent data and the caller MUST wipe
+ * them
+ */
+static inline
+REALLY_FORCE_INLINE
+/**/
+unsigned int simd_no_dualfactor64x16(uint16_t u[static 64],
+                                    uint16_t rt[static 64],
+                                    uint16_t rs[static 64],
+                                   uint16_t tm2[static 64],
+                             const uint16_t modn[static 64],
+                              const uint16_t inv[static 64],
+                            const uint16_t limit[static 64],
+                                  unsigned int want)
+{
+	unsigned int rc = 0;
+					// u[] = modn[] * 1/prime  mod 2^16
+
+	simd_mul16x16(  u,          modn,          inv       );
+	simd_mul16x16(&(u[ 16 ]), &(modn[ 16 ]), &(inv[ 16 ]));
+	simd_mul16x16(&(u[ 32 ]), &(modn[ 32 ]), &(inv[ 32 ]));
+	simd_mul16x16(&(u[ 48 ]), &(modn[ 48 ]), &(inv[ 48 ]));
+
+	if (want & SIMD_DUAL_TWIN) {
+		simd_cmp16x16_twin(  rt,        tm2,        u,
+		                     inv,       limit);
+		simd_cmp16x16_twin(&(rt[ 16 ]),&(tm2[ 16 ]),&(u[ 16 ]),
+		                  &(inv[ 16 ]),&(limit[ 16 ]));
+		simd_cmp16x16_twin(&(rt[ 32 ]),&(tm2[ 32 ]),&(u[ 32 ]),
+		                  &(inv[ 32 ]),&(limit[ 32 ]));
+		simd_cmp16x16_twin(&(rt[ 48 ]),&(tm2[ 48 ]),&(u[ 48 ]),
+		                  &(inv[ 48 ]),&(limit[ 48 ]));
+
+		if (simd_is_all0x64x16_inpl(rt, tm2))
+			rc |= SIMD_DUAL_TWIN;
+	}
+
+	if (want & SIMD_DUAL_SAFE) {
+		simd_spcmp16x16(  rs,          u,          inv,
+		                  limit);
+		simd_spcmp16x16(&(rs[ 16 ]), &(u[ 16 ]), &(inv[ 16 ]),
+		               &(limit[ 16 ]));
+		simd_spcmp16x16(&(rs[ 32 ]), &(u[ 32 ]), &(inv[ 32 ]),
+		               &(limit[ 32 ]));
+		simd_spcmp16x16(&(rs[ 48 ]), &(u[ 48 ]), &(inv[ 48 ]),
+		               &(limit[ 48 ]));
+
+		if (simd_is_all0x64x16_inpl(rs, tm2))
+			rc |= SIMD_DUAL_SAFE;
+	}
+
+	return rc;
+}
+
+
+/*--------------------------------------
+ * joint rest walk over groups [64, lanes); conditions drop out as
+ * they pick up factors, the walk ends once none are left
+ *
+ * the dedicated twin/safe rest chains are contiguous over the same
+ * range, so the runtime-bounded loop form checks identical primes
+ */
+static inline
+unsigned int simd_no_dualfactor_rest_r(uint16_t u[static 64],
+                                      uint16_t rt[static 64],
+                                      uint16_t rs[static 64],
+                                     uint16_t tm2[static 64],
+                       const struct PP_Mod16bit *ps,
+                               unsigned int lanes, unsigned int want)
+{
+	unsigned int g;
+
+	for (g=64; (g<lanes) && want; g+=64) {
+		want &= simd_no_dualfactor64x16(u, rt, rs, tm2,
+		                                  &(ps->modn[ g ]),
+		                 &(firstprimes_inverse_simd[ g ]),
+		                &(firstprimes_mullimit_simd[ g ]), want);
+	}
+
+	return want;
+}
+
+
+/*--------------------------------------
+ * fused twin+safe search: fill tlsb[] with lsb64 of twin-viable and
+ * slsb[] with lsb64 of safe-viable candidates, 'count' entries each,
+ * walking the prime table once per candidate for both conditions
+ *
+ * a filled stream freezes while the other continues; the state parks
+ * past the last candidate checked, as the dedicated twin/safe drivers
+ * do.  dst->mode records a safe-prime search
+ *
+ * returns final dst->lsb; 0 if inputs are unusable
+ */
+static
+SIMD_ISA_CLONES
+SIMD_OPTIONAL_FN
+uint64_t dual_advance(uint64_t *tlsb, uint64_t *slsb, unsigned long count,
+            struct PP_Mod16bit *dst,
+      const struct PP_Mod16bit *src)
+{
+	SIMD_ALIGN uint16_t u  [ 64 ];
+	SIMD_ALIGN uint16_t rt [ 64 ];
+	SIMD_ALIGN uint16_t rs [ 64 ];
+	SIMD_ALIGN uint16_t tm2[ 64 ];
+	unsigned long twr = 0, swr = 0;
+	unsigned int lanes;
+
+	if (!tlsb || !slsb)
+		return 0;
+
+	count = init_search(tlsb, count, dst, src, SIMD_PRIMETYPE_SAFE);
+	if (!count)
+		return 0;
+
+	switch (dst->mode & SIMD_SEARCHTABLE_MASK) {
+#if !defined(NO_SIMDDIVIDE_S)
+	case SIMD_SEARCHTABLE_S:
+		lanes = 576;
+		break;
+#endif
+
+#if !defined(NO_SIMDDIVIDE_M)
+	case SIMD_SEARCHTABLE_M:
+		lanes = 1856;
+		break;
+#endif
+
+#if !defined(NO_SIMDDIVIDE_L)
+	case SIMD_SEARCHTABLE_L:
+		lanes = 3456;
+		break;
+#endif
+
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+	case SIMD_SEARCHTABLE_C:
+		lanes = SIMDPRIME_COUNT_CUSTOM;
+		break;
+#endif
+
+	default:
+		return 0;
+	}
+
+	while (((twr < count) || (swr < count)) &&
+	       scan_budget_ok(1)) {     // invariant: candidate is 6k+5
+		unsigned int bits, g, skip = 0;
+		unsigned int want = ((twr < count) ? SIMD_DUAL_TWIN : 0) |
+		                    ((swr < count) ? SIMD_DUAL_SAFE : 0);
+
+		// advance to first index where either condition MAY
+		// hold based on the first 64 primes, or skip >= 2^14
+		// (see the dedicated drivers for the carry limit)
+
+		while (!(skip >> 14) &&
+		       !(bits = simd_no_dualfactor64x16(u, rt, rs, tm2,
+		                                 dst->modn,
+		                                 firstprimes_inverse_simd,
+		                                 firstprimes_mullimit_simd,
+		                                 want)))
+		{
+			simd_advance64x16_m2r_inpl(dst->modn, 6,
+			                  firstprimes_mod2range_simd);
+			skip += 6;
+		}
+
+		state_advance_nr(dst, skip);
+
+					// only first 64 have been advanced
+					// now advance entries >64,
+		if (skip) {
+			for (g=64; g<lanes; g+=64) {
+				simd_advance64x16_m2r_inpl(&(dst->modn[ g ]),
+				                           skip,
+				   &(firstprimes_mod2range_simd[ g ]));
+			}
+		}
+
+		if (skip >> 14)
+			continue;
+
+		bits = simd_no_dualfactor_rest_r(u, rt, rs, tm2, dst,
+		                                 lanes, bits);
+
+		if (bits & SIMD_DUAL_TWIN)
+			twr = report_current_lsb(tlsb, count, dst->lsb, twr);
+		if (bits & SIMD_DUAL_SAFE)
+			swr = report_current_lsb(slsb, count, dst->lsb, swr);
+
+		simd_advance_all(dst, 6);
+	}
+
+	wipe(u,   sizeof(u));
+	wipe(rt,  sizeof(rt));
+	wipe(rs,  sizeof(rs));
+	wipe(tm2, sizeof(tm2));
+
+	return dst->lsb;
+}
+#endif  //-----  !NO_SIMD_DUALSCAN  -------------------------------------------
+
+
+#if !defined(NO_SIMD_KTUPLE) && \
+    !defined(SIMD_BENCH)      //-----  prime k-tuple (constellation) scan  ----
+// constellation searches (p, p+2, p+6, p+8 and similar patterns) used
+// to SIMD-prescreen p only and post-filter the companions, discarding
+// most of the prescreen's value.  the k-tuple kernel takes a small
+// runtime set of companion offsets and rejects a candidate when ANY
+// tuple member has a small factor: with d*(1/prime[]) precomputed per
+// offset, each extra offset costs one add+compare+OR per lane over the
+// shared modn[]*1/prime[] products
+
+#define  SIMD_KTUPLE_MAX_OFFS  ((unsigned int) 8)
+
+/*--------------------------------------
+ * companion offsets and their premultiplied d * 1/prime[] rows
+ *
+ * contents derive only from public offsets and the public inverse
+ * table; no wipe needed
+ */
+struct SIMD_KTuple {
+	unsigned int count;                       // nr. of companion offsets
+	unsigned int mod6ok;       // viable candidate residues: bit0 - 6k+1,
+	                           // bit1 - 6k+5
+	unsigned int offs[ SIMD_KTUPLE_MAX_OFFS ];
+	uint16_t oinv[ SIMD_KTUPLE_MAX_OFFS ][ SIMDPRIME_COUNT ];
+} ;
+//
+#define  SIMD_KTUPLE_INIT0  { 0, 0, { 0, }, { { 0, }, }, }
+
+
+/*--------------------------------------
+ * register 'ocount' companion offsets; the candidate itself (offset 0)
+ * is always checked and MUST NOT be listed
+ *
+ * offsets are required even: odd ones turn the companion even, which
+ * the odd-prime tables can not reject.  similarly, 2 and 3 are absent
+ * from the tables (see the small-prime notes above), so ktuple_init()
+ * derives which 6k+1/6k+5 residues keep every member off 3's ladder;
+ * patterns with no such residue are rejected here
+ *
+ * returns >0 if set up; <0 if anything inconsistent
+ */
+static SIMD_OPTIONAL_FN
+int ktuple_init(struct SIMD_KTuple *kt, const unsigned int *offs,
+                             unsigned int ocount)
+{
+	unsigned int i, l;
+
+	if (!kt || !offs || !ocount || (ocount > SIMD_KTUPLE_MAX_OFFS))
+		return cu_reportrc("invalid k-tuple offset list", -1);
+
+	kt->mod6ok = 3;                          // both residues, until an
+	                                         // offset rules one out
+	for (i=0; i<ocount; ++i) {
+		if (!offs[ i ] || (offs[ i ] & 1))
+			return cu_reportrc("k-tuple offsets must be "
+			                   "even and nonzero", -1);
+
+		switch (offs[ i ] % 6) {
+		case 2:
+			kt->mod6ok &= ~((unsigned int) 1);   // 6k+1: 3 | u+2
+			break;
+		case 4:
+			kt->mod6ok &= ~((unsigned int) 2);   // 6k+5: 3 | u+4
+			break;
+		default:                                     // 0 mod 6: both
+			break;
+		}
+	}
+
+	if (!kt->mod6ok)
+		return cu_reportrc("k-tuple pattern always hits "
+		                   "a multiple of 3", -1);
+
+	kt->count = ocount;
+
+	for (i=0; i<ocount; ++i) {
+		kt->offs[ i ] = offs[ i ];
+
+		for (l=0; l<SIMDPRIME_COUNT; ++l) {
+			kt->oinv[ i ][ l ] = (uint16_t) (offs[ i ] *
+			                firstprimes_inverse_simd[ l ]);
+		}
+	}
+
+	return 1;
+}
+
+
+/*--------------------------------------
+ * step from the current viable residue to the next one
+ * mod6 is 1 or 5; with both residues viable this is the usual 6k+-1
+ * alternation, otherwise a full 6
+ */
+static inline unsigned int ktuple_step(const struct SIMD_KTuple *kt,
+                                             unsigned int mod6)
+{
+	if (kt->mod6ok == 3)
+		return (mod6 == 1) ? 4 : 2;
+
+	return 6;
+}
+
+
+/*--------------------------------------
+ * does any tuple member (u, or u + offset) have a factor in this
+ * 64-lane group?
+ *
+ * rely on (u+d)*(1/P) == u*(1/P) + d*(1/P)  mod 2^16, so each offset
+ * reuses the shared products in u[]
+ *
+ * 'base' is the group's first lane, indexing the premultiplied rows
+ * u[], r[] and tm2[] are filled with (potentially)secret-dependent
+ * data and the caller MUST wipe them
+ *
+ * returns >0 if no tuple member has a factor in this group
+ */
+static inline
+REALLY_FORCE_INLINE
+/**/
+uint16_t simd_no_ktuplefactor64x16(uint16_t u[static 64],
+                                   uint16_t r[static 64],
+                                 uint16_t tm2[static 64],
+                           const uint16_t modn[static 64],
+                            const uint16_t inv[static 64],
+                          const uint16_t limit[static 64],
+                  const struct SIMD_KTuple *kt, unsigned int base)
+{
+	unsigned int k;
+					// u[] = modn[] * 1/prime  mod 2^16
+
+	simd_mul16x16(  u,          modn,          inv       );
+	simd_mul16x16(&(u[ 16 ]), &(modn[ 16 ]), &(inv[ 16 ]));
+	simd_mul16x16(&(u[ 32 ]), &(modn[ 32 ]), &(inv[ 32 ]));
+	simd_mul16x16(&(u[ 48 ]), &(modn[ 48 ]), &(inv[ 48 ]));
+
+					// r[] = offset-0 (candidate) masks
+
+	simd_lemask16x16(  r,          u,          limit       );
+	simd_lemask16x16(&(r[ 16 ]), &(u[ 16 ]), &(limit[ 16 ]));
+	simd_lemask16x16(&(r[ 32 ]), &(u[ 32 ]), &(limit[ 32 ]));
+	simd_lemask16x16(&(r[ 48 ]), &(u[ 48 ]), &(limit[ 48 ]));
+
+	for (k=0; k<kt->count; ++k) {
+		const uint16_t *oi = &(kt->oinv[ k ][ base ]);
+
+		simd_add16x16(  tm2,          u,          oi       );
+		simd_add16x16(&(tm2[ 16 ]), &(u[ 16 ]), &(oi[ 16 ]));
+		simd_add16x16(&(tm2[ 32 ]), &(u[ 32 ]), &(oi[ 32 ]));
+		simd_add16x16(&(tm2[ 48 ]), &(u[ 48 ]), &(oi[ 48 ]));
+
+		simd_lemask16x16_inpl(  tm2,          limit       );
+		simd_lemask16x16_inpl(&(tm2[ 16 ]), &(limit[ 16 ]));
+		simd_lemask16x16_inpl(&(tm2[ 32 ]), &(limit[ 32 ]));
+		simd_lemask16x16_inpl(&(tm2[ 48 ]), &(limit[ 48 ]));
+
+		simd_or16x16(  r,          r,          tm2       );
+		simd_or16x16(&(r[ 16 ]), &(r[ 16 ]), &(tm2[ 16 ]));
+		simd_or16x16(&(r[ 32 ]), &(r[ 32 ]), &(tm2[ 32 ]));
+		simd_or16x16(&(r[ 48 ]), &(r[ 48 ]), &(tm2[ 48 ]));
+	}
+
+	return simd_is_all0x64x16_inpl(r, tm2);
+}
+
+
+/*--------------------------------------
+ * tuple walk over groups [64, lanes); ends at the first group
+ * rejecting any tuple member
+ */
+static inline
+uint16_t simd_no_ktuplefactor_rest_r(uint16_t u[static 64],
+                                     uint16_t r[static 64],
+                                   uint16_t tm2[static 64],
+                     const struct PP_Mod16bit *ps,
+                             unsigned int lanes,
+                 const struct SIMD_KTuple *kt)
+{
+	unsigned int g;
+
+	for (g=64; g<lanes; g+=64) {
+		if (!simd_no_ktuplefactor64x16(u, r, tm2,
+		                                 &(ps->modn[ g ]),
+		                &(firstprimes_inverse_simd[ g ]),
+		               &(firstprimes_mullimit_simd[ g ]), kt, g))
+			return 0;
+	}
+
+	return 1;
+}
+
+
+/*--------------------------------------
+ * fill lsb[] with lsb64 of candidates where no tuple member has a
+ * small factor; 'kt' MUST have been set up by ktuple_init()
+ *
+ * walks the 6k+-1 residues ktuple_init() found viable for the pattern;
+ * residues incompatible with deeper primes die against the fused check
+ * immediately, so a pattern-specific wheel buys little.  parks on the
+ * last survivor, as the plain drivers do
+ *
+ * returns final dst->lsb; 0 if inputs are unusable
+ */
+static
+SIMD_ISA_CLONES
+SIMD_OPTIONAL_FN
+uint64_t ktuple_advance(uint64_t *lsb, unsigned long count,
+              struct PP_Mod16bit *dst,
+        const struct PP_Mod16bit *src,
+    const struct SIMD_KTuple *kt)
+{
+	SIMD_ALIGN uint16_t u  [ 64 ];
+	SIMD_ALIGN uint16_t r  [ 64 ];
+	SIMD_ALIGN uint16_t tm2[ 64 ];
+	unsigned long wr = 0;
+	unsigned int lanes;
+
+	if (!kt || !kt->count)
+		return 0;
+
+	count = init_search(lsb, count, dst, src, SIMD_PRIMETYPE_PLAIN);
+	if (!count)
+		return 0;
+
+	switch (dst->mode & SIMD_SEARCHTABLE_MASK) {
+#if !defined(NO_SIMDDIVIDE_S)
+	case SIMD_SEARCHTABLE_S:
+		lanes = 576;
+		break;
+#endif
+
+#if !defined(NO_SIMDDIVIDE_M)
+	case SIMD_SEARCHTABLE_M:
+		lanes = 1856;
+		break;
+#endif
+
+#if !defined(NO_SIMDDIVIDE_L)
+	case SIMD_SEARCHTABLE_L:
+		lanes = 3456;
+		break;
+#endif
+
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+	case SIMD_SEARCHTABLE_C:
+		lanes = SIMDPRIME_COUNT_CUSTOM;
+		break;
+#endif
+
+	default:
+		return 0;
+	}
+
+				// init_search() parked on 6k+1 or 6k+5;
+				// hop to the other residue if the pattern
+				// rules this one out
+	if (!((kt->mod6ok >> ((dst->mod6 == 5) ? 1 : 0)) & 1))
+		simd_advance_all(dst, (dst->mod6 == 1) ? 4 : 2);
+
+	while ((wr < count) &&
+	       scan_budget_ok(1)) {       // one tuple-base full check
+		unsigned int m6 = dst->mod6;
+		unsigned int g, skip = 0;
+
+		// advance to first index where all tuple members MAY
+		// be prime based on the first 64 primes, or skip >= 2^14
+		// (see the dedicated drivers for the carry limit)
+		//
+		// dst->mod6 only updates with state_advance_nr() below;
+		// track the residue locally while hopping
+
+		while (!(skip >> 14) &&
+		       !simd_no_ktuplefactor64x16(u, r, tm2, dst->modn,
+		                                  firstprimes_inverse_simd,
+		                                  firstprimes_mullimit_simd,
+		                                  kt, 0))
+		{
+			unsigned int a = ktuple_step(kt, m6);
+
+			simd_advance64x16_m2r_inpl(dst->modn, a,
+			                  firstprimes_mod2range_simd);
+			skip += a;
+			m6    = (m6 + a) % 6;
+		}
+
+		state_advance_nr(dst, skip);
+
+					// only first 64 have been advanced
+					// now advance entries >64,
+		if (skip) {
+			for (g=64; g<lanes; g+=64) {
+				simd_advance64x16_m2r_inpl(&(dst->modn[ g ]),
+				                           skip,
+				   &(firstprimes_mod2range_simd[ g ]));
+			}
+		}
+
+		if (skip >> 14)
+			continue;
+
+		if (simd_no_ktuplefactor_rest_r(u, r, tm2, dst, lanes, kt)) {
+			wr = report_current_lsb(lsb, count, dst->lsb, wr);
+
+			if (wr >= count)
+				break;           // park on the last survivor
+		}
+
+		simd_advance_all(dst, ktuple_step(kt, dst->mod6));
+	}
+
+	wipe(u,   sizeof(u));
+	wipe(r,   sizeof(r));
+	wipe(tm2, sizeof(tm2));
+
+	return dst->lsb;
+}
+#endif  //-----  !NO_SIMD_KTUPLE  ---------------------------------------------
+
+
+#if !defined(NO_SIMD_FIPS186PRIME) && \
+    !defined(SIMD_BENCH)      //-----  FIPS 186-x incremental search  --------
+// candidates are c0 + j*increment for j = 0, 1, ...: per-lane
+// remainders step by the reduced increment rows of ps->incr[] (vector
+// addition, see simd_advance_rest_v_aw()), never by scalar constants.
+// 2 and 3 are absent from the prime tables, so candidates on their
+// ladders are dropped through the mod-6 tracking instead of lanes
+
+/*--------------------------------------
+ * one full increment step: all lanes, lsb64 and mod-6 phase
+ *
+ * modn8[] shadow stays stale, as during twin/safe searches: nothing
+ * on this path reads it
+ */
+static inline void fips_state_incr(struct PP_Mod16bit *dst)
+{
+	simd_advance64x16_m2r_inpl_v(dst->modn, dst->incr,
+	                             firstprimes_mod2range_simd);
+
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+	{
+	unsigned int g;
+
+	for (g=64; g<SIMDPRIME_COUNT_CUSTOM; g+=64) {
+		simd_advance64x16_m2r_inpl_v(&(dst->modn[ g ]),
+		                             &(dst->incr[ g ]),
+		            &(firstprimes_mod2range_simd[ g ]));
+	}
+	}
+#else
+	simd_advance_rest_v_aw(dst);
+#endif
+
+	dst->lsb  += dst->lsbi;
+	dst->mod6  = (dst->mod6 + dst->mod6incr) % 6;
+}
+
+
+/*--------------------------------------
+ * FIPS 186-x incremental search: fill lsb[] with lsb64 of sequence
+ * members with no small factor; state must carry a parsed increment
+ * (SIMD_FIELDSET_INCR)
+ *
+ * note: as with the lsb/lsbi fields themselves, 64-bit wraps of the
+ * tracked least-significant digits are not managed here
+ *
+ * parks on the last survivor, as the plain drivers do
+ *
+ * returns final dst->lsb; 0 if inputs are unusable, including
+ * degenerate sequences stuck on 2's or 3's ladder
+ */
+static
+SIMD_ISA_CLONES
+uint64_t fips_advance(uint64_t *lsb, unsigned long count,
+            struct PP_Mod16bit *dst,
+      const struct PP_Mod16bit *src)
+{
+	SIMD_ALIGN uint16_t tmp[ 64 ];
+	SIMD_ALIGN uint16_t tm2[ 64 ];
+	SIMD_ALIGN uint16_t adv[ SIMDPRIME_COUNT ];
+	unsigned long wr = 0;
+	unsigned int lanes;
+
+	count = init_search(lsb, count, dst, src, SIMD_PRIMETYPE_FIPS186);
+	if (!count)
+		return 0;
+
+	if (!(SIMD_FIELDSET_INCR & dst->mode))
+		return 0;                        // no increment was parsed
+
+			// every sequence member even, or every one a
+			// multiple of 3: nothing here can ever be prime
+	if (!((dst->lsb | dst->lsbi) & 1))
+		return 0;
+	if (!(dst->mod6 % 3) && !(dst->mod6incr % 3))
+		return 0;
+
+	switch (dst->mode & SIMD_SEARCHTABLE_MASK) {
+#if !defined(NO_SIMDDIVIDE_S)
+	case SIMD_SEARCHTABLE_S:
+		lanes = 576;
+		break;
+#endif
+
+#if !defined(NO_SIMDDIVIDE_M)
+	case SIMD_SEARCHTABLE_M:
+		lanes = 1856;
+		break;
+#endif
+
+#if !defined(NO_SIMDDIVIDE_L)
+	case SIMD_SEARCHTABLE_L:
+		lanes = 3456;
+		break;
+#endif
+
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+	case SIMD_SEARCHTABLE_C:
+		lanes = SIMDPRIME_COUNT_CUSTOM;
+		break;
+#endif
+
+	default:
+		return 0;
+	}
+
+	while ((wr < count) &&
+	       scan_budget_ok(1)) {     // one sequence-member full check
+		unsigned int m6 = dst->mod6;
+		unsigned int g, steps = 0;
+
+		// step the first 64 lanes by incr[] until the candidate
+		// MAY be prime: off the 2/3 ladders (tracked mod 6) and
+		// no factor among the first 64 primes.  streaks are
+		// capped so the catch-up multipliers stay within u32
+		//
+		// dst->mod6/lsb only update with the catch-up below;
+		// track the residue locally while stepping
+
+		while (!(steps >> 14) &&
+		       !((m6 % 2) && (m6 % 3) &&
+		         simd_nofactor64x16(tmp, tm2, dst->modn,
+		                            firstprimes_inverse_simd,
+		                            firstprimes_mullimit_simd)))
+		{
+			simd_advance64x16_m2r_inpl_v(dst->modn, dst->incr,
+			                  firstprimes_mod2range_simd);
+			m6 = (m6 + dst->mod6incr) % 6;
+			++steps;
+		}
+
+		// catch up lsb64/mod-6 and the lanes >= 64: lane i
+		// moved by steps * incr[i], reduced per prime
+		//
+		if (steps) {
+			unsigned int i;
+
+			dst->lsb += (uint64_t) steps * dst->lsbi;
+			dst->mod6 = m6;
+
+			for (i=64; i<lanes; ++i) {
+				adv[i] = (uint16_t)
+				         (((uint32_t) steps * dst->incr[i])
+				          % firstprimes[i]);
+			}
+
+			for (g=64; g<lanes; g+=64) {
+				simd_advance64x16_m2r_inpl_v(&(dst->modn[ g ]),
+				                                  &(adv[ g ]),
+				     &(firstprimes_mod2range_simd[ g ]));
+			}
+		}
+
+		if (steps >> 14)
+			continue;
+
+		for (g=64; g<lanes; g+=64) {
+			if (!simd_nofactor64x16(tmp, tm2, &(dst->modn[ g ]),
+			              &(firstprimes_inverse_simd[ g ]),
+			             &(firstprimes_mullimit_simd[ g ])))
+				break;
+		}
+
+		if (g >= lanes)
+			wr = report_current_lsb(lsb, count, dst->lsb, wr);
+
+		if (wr < count)
+			fips_state_incr(dst);   // past the current candidate
+	}
+
+	wipe(tmp, sizeof(tmp));
+	wipe(tm2, sizeof(tm2));
+	wipe(adv, sizeof(adv));       // steps * (secret-derived increments)
+
+	return dst->lsb;
+}
+#endif  //-----  !NO_SIMD_FIPS186PRIME  ---------------------------------------
+
+
+#if !defined(SIMD_BENCH)    // search engines unused by kernel benchmarks
+
+/*--------------------------------------
+ * dispatch to the widest driver matching 'primetype'
+ * state must already be in 'dst'
+ */
+static uint64_t search_advance_bytype(uint64_t *lsb, unsigned long count,
+                            struct PP_Mod16bit *dst,
+                                  unsigned int primetype)
+{
+	switch (primetype & SIMD_PRIMETYPE_MASK) {
+#if !defined(NO_SIMD_TWINPRIME)
+	case SIMD_PRIMETYPE_TWIN:
+		return twin_advance_w(lsb, count, dst, dst);
+#endif
+
+#if !defined(NO_SIMD_SAFEPRIME)
+	case SIMD_PRIMETYPE_SAFE:
+		return sfsieve_advance(lsb, count, dst, dst);
+#endif
+
+#if !defined(NO_SIMD_FIPS186PRIME)
+	case SIMD_PRIMETYPE_FIPS186:
+		return fips_advance(lsb, count, dst, dst);
+#endif
+
+	default:
+#if !defined(NO_SIMD_PLAINPRIME)
+		return plain_advance(lsb, count, dst, dst);
+#else
+		return 0;
+#endif
+	}
+}
+
+
+#if !defined(NO_SIMD_SCANBOUND)
+/*--------------------------------------
+ * minimal-latency convenience: return the first survivor after 'src',
+ * giving up after 'checks' full candidate checks
+ *
+ * *dst is left parked either way, resumable by any driver of the
+ * same search type; a successful call parks ON the survivor, as the
+ * batch drivers do, so resumed scans see it as their first candidate
+ *
+ * returns the survivor LSB64, 0 if the budget ran out first
+ */
+static ATTR_UNUSED__           // embedder-only; tool arms BUDGET= itself
+uint64_t simd_first_hit(struct PP_Mod16bit *dst,
+                  const struct PP_Mod16bit *src, uint64_t checks)
+{
+	uint64_t one = 0;
+
+	if (!dst || !src || !checks)
+		return 0;
+
+	if (dst != src)
+		*dst = *src;
+
+	simd_scan_limit(checks);
+	search_advance_bytype(&one, 1, dst, dst->mode);
+	simd_scan_limit_clear();
+
+	return one;
+}
+#endif   // !NO_SIMD_SCANBOUND
+
+
+#if 1  //=====  delimiter: streaming survivor sink  ==========================
+// batched alternative to the all-results-up-front drivers: survivors
+// are handed to a caller callback in cache-sized batches, so unbounded
+// searches run in a fixed, small footprint (and downstream stages may
+// start before the scan window completes)
+
+/*--------------------------------------
+ * survivor sink, called once per full (or final partial) batch
+ *
+ * return 0 to continue the scan; nonzero stops after the current batch
+ * lsb[] contents are only valid for the duration of the call
+ */
+typedef int (*SIMD_SinkFn)(void *ctx, const uint64_t *lsb,
+                                  unsigned long count);
+
+// batch elements; 4K x u64 stays L1/L2-resident on all our targets
+//
+#define  SIMD_SINK_BATCH  ((unsigned long) 4096)
+
+
+/*--------------------------------------
+ * scan, delivering survivors to 'sink' in SIMD_SINK_BATCH units
+ *
+ * 'total' >0 limits the number of survivors; 0 scans until the sink
+ * terminates the search
+ *
+ * search type and table size are taken from src->mode, as with the
+ * array-filling drivers; 'dst' is left at the last scanned candidate
+ *
+ * returns last lsb64 enumerated; 0 if inputs are unusable
+ */
+static SIMD_OPTIONAL_FN uint64_t sink_advance(SIMD_SinkFn sink, void *ctx,
+                   uint64_t total,
+         struct PP_Mod16bit *dst,
+   const struct PP_Mod16bit *src)
+{
+	uint64_t batch[ SIMD_SINK_BATCH ];
+	uint64_t done = 0, rc = 0;
+	unsigned int primetype;
+
+	if (!sink || !dst || !src)
+		return 0;
+
+	scan_inherit_or0(dst, src);
+
+	primetype = dst->mode & SIMD_PRIMETYPE_MASK;
+
+	while (!total || (done < total)) {
+		unsigned long now = SIMD_SINK_BATCH;
+
+		if (total && ((total - done) < (uint64_t) now))
+			now = (unsigned long) (total - done);
+
+		rc = search_advance_bytype(batch, now, dst, primetype);
+
+		done += now;
+
+		if (sink(ctx, batch, now))
+			break;
+
+		// plain and FIPS drivers return with the last-reported
+		// candidate still current; step past it before resuming,
+		// so the next batch does not re-report it
+		// (twin/safe loops advance past their last report)
+		//
+		// FIPS states must stay on the c0 +j*increment lattice:
+		// step by the increment, as the driver's own loop does
+		//
+		if (primetype == SIMD_PRIMETYPE_FIPS186) {
+#if !defined(NO_SIMD_FIPS186PRIME)
+			fips_state_incr(dst);
+#endif
+		} else if ((primetype != SIMD_PRIMETYPE_TWIN) &&
+		           (primetype != SIMD_PRIMETYPE_SAFE)) {
+#if !defined(NO_SIMD_PLAINPRIME)
+			simd_advance_all(dst, (dst->mod6 == 1) ? 4 : 2);
+#endif
+		}
+	}
+
+	wipe(batch, sizeof(batch));
+
+	return rc;
+}
+#endif   //=====  /delimiter: streaming survivor sink  =======================
+
+
+#if !defined(NO_SIMD_NUMA)  //=====  delimiter: page placement helpers  ======
+// hugepage-backed buffers and worker pinning for multi-socket hosts:
+// the survivor arrays reach 80MB and the scan is bandwidth-bound at
+// the L table size, so TLB pressure and cross-socket traffic both
+// show up in profiles.  first touch places anonymous mappings, so a
+// pinned worker touching its own state keeps every stream node-local
+//
+// Linux only for the mmap/madvise and affinity paths; other platforms
+// fall back to calloc()/free() and ignore pinning
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/*--------------------------------------
+ * page-granular allocation, hugepage-backed where the kernel offers
+ * it (advisory; fine to run without THP)
+ *
+ * contents are zero on return, as with calloc()
+ * release through simd_free_pages() with the same byte count
+ */
+static SIMD_OPTIONAL_FN void *simd_alloc_pages(size_t bytes)
+{
+#if defined(__linux__)
+	void *p = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+	               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (p == MAP_FAILED)
+		return NULL;
+
+#if defined(MADV_HUGEPAGE)
+	(void) madvise(p, bytes, MADV_HUGEPAGE);
+#endif
+
+	return p;
+#else
+	return calloc(1, bytes);
+#endif
+}
+
+
+/*--------------------------------------*/
+static SIMD_OPTIONAL_FN void simd_free_pages(void *p, size_t bytes)
+{
+#if defined(__linux__)
+	if (p)
+		munmap(p, bytes);
+#else
+	(void) bytes;
+	free(p);
+#endif
+}
+
+
+/*--------------------------------------
+ * pin the calling thread to CPU (idx mod nr-of-CPUs)
+ *
+ * with one scan per socket, consecutive worker indexes land on the
+ * OS's CPU enumeration; pair with taskset/cpuset masks for explicit
+ * socket splits
+ *
+ * raw syscall keeps the TU free of _GNU_SOURCE, which the glibc
+ * affinity wrappers would force on every include above
+ *
+ * returns 0 if pinned; nonzero (and an unchanged mask) otherwise
+ */
+static int simd_pin_worker(unsigned int idx)
+{
+#if defined(__linux__) && defined(SYS_sched_setaffinity)
+	unsigned long mask[ 16 ] = { 0, };            // up to 1024 CPUs
+	long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+	unsigned int cpu, w = 8 * sizeof(mask[0]);
+
+	if (ncpu < 1)
+		return -1;
+
+	cpu = idx % (unsigned int) ncpu;
+	mask[ cpu / w ] |= (unsigned long) 1 << (cpu % w);
+
+	return syscall(SYS_sched_setaffinity, 0, sizeof(mask), mask)
+	       ? -1 : 0;
+#else
+	(void) idx;
+	return -1;
+#endif
+}
+#endif   //=====  /delimiter: page placement helpers  ========================
+
+
+#if !defined(NO_SIMD_MTSEARCH)  //=====  delimiter: parallel search engine  ==
+// sharded, self-scheduling multi-threaded search, driving the
+// single-stream _advance() drivers above with per-worker state clones
+//
+// POSIX threads only; define NO_SIMD_MTSEARCH on platforms without them
+
+#include <pthread.h>
+
+/*--------------------------------------
+ * one shard: clone of the search state, advanced to the shard's start,
+ * plus the shard's contiguous slice of the survivor-output array
+ */
+struct SIMD_MTShard {
+	struct PP_Mod16bit ps;          // shard-local state clone
+
+	uint64_t *lsb;                  // slice of survivor output
+	unsigned long count;            // slice capacity
+
+	uint64_t last;                  // driver-reported last lsb64
+} ;
+
+
+/*--------------------------------------
+ * shard pool; workers claim shards through the 'next' counter, so
+ * uneven shards self-balance (fast workers pull more shards)
+ */
+struct SIMD_MTPool {
+	struct SIMD_MTShard *shards;
+	unsigned long nshards;
+
+	unsigned long next;             // next unclaimed shard index
+
+	pthread_mutex_t lock;
+
+	unsigned int primetype;         // see PrimeType_t
+
+#if !defined(NO_SIMD_NUMA)
+	unsigned int pin;               // pin workers to consecutive CPUs
+	unsigned int wnext;             // next worker index to hand out
+#endif
+} ;
+
+
+/*--------------------------------------
+ * advance 'ps' to its shard start; one fold per prime, see state_jump()
+ */
+static void simd_mt_warmup(struct PP_Mod16bit *ps, uint64_t delta)
+{
+	if (delta)
+		state_jump(ps, delta);
+}
+
+
+/*--------------------------------------
+ * worker: claim+run shards until none left
+ */
+static void *simd_mt_worker(void *arg)
+{
+	struct SIMD_MTPool *pool = (struct SIMD_MTPool *) arg;
+
+#if !defined(NO_SIMD_NUMA)
+	if (pool->pin) {
+		unsigned int w;
+
+		pthread_mutex_lock(&( pool->lock ));
+		w = pool->wnext++;
+		pthread_mutex_unlock(&( pool->lock ));
+
+		(void) simd_pin_worker(w);
+	}
+#endif
+
+	while (1) {
+		struct SIMD_MTShard *shard;
+		unsigned long idx;
+
+		pthread_mutex_lock(&( pool->lock ));
+		idx = pool->next++;
+		pthread_mutex_unlock(&( pool->lock ));
+
+		if (idx >= pool->nshards)
+			break;
+
+		shard = &( pool->shards[ idx ] );
+
+#if !defined(NO_SIMD_NUMA)
+		{
+		// work on a worker-stack clone: first touch places the
+		// remainder tables on the worker's own node, instead of
+		// wherever the preparing thread ran
+		//
+		struct PP_Mod16bit local = shard->ps;
+
+		shard->last = search_advance_bytype(shard->lsb, shard->count,
+		                                    &local, pool->primetype);
+		shard->ps = local;
+
+		wipe(&local, sizeof(local));
+		}
+#else
+		shard->last = search_advance_bytype(shard->lsb, shard->count,
+		                                    &( shard->ps ),
+		                                    pool->primetype);
+#endif
+	}
+
+	return NULL;
+}
+
+
+// shards per worker thread; oversubscription lets self-scheduling
+// even out shard-to-shard variance
+//
+#define  SIMD_MT_SHARDS_PER_THREAD  ((unsigned long) 4)
+
+
+/*--------------------------------------
+ * multi-threaded sharded search [main entry point]
+ *
+ * clones 'src' per shard; shard k starts 'stride' candidates after
+ * shard k-1 and fills its own contiguous slice of lsb[count], so the
+ * concatenated output is already ordered by shard
+ *
+ * 'stride' 0 selects a rough default. NOTE: caller is expected to pick
+ * a stride covering the candidates one slice's worth of survivors
+ * needs; shards overlap (duplicating survivors) if stride is too
+ * small, since slice-filling drivers run until their slice is full.
+ *
+ * 'dst' is left at the final state of the last shard
+ *
+ * 'pin' >0 pins workers to consecutive CPUs (see simd_pin_worker());
+ * 0 leaves scheduling to the OS
+ *
+ * returns last lsb64 enumerated by the last shard; 0 if anything failed
+ */
+static SIMD_OPTIONAL_FN
+uint64_t simd_mt_search(uint64_t *lsb, unsigned long count,
+                     struct PP_Mod16bit *dst,
+               const struct PP_Mod16bit *src,
+                         unsigned int nthreads,
+                            uint64_t stride,
+                         unsigned int pin)
+{
+	struct SIMD_MTPool pool = { NULL, 0, 0, PTHREAD_MUTEX_INITIALIZER, 0,
+#if !defined(NO_SIMD_NUMA)
+	                            0, 0,
+#endif
+	                          };
+	unsigned long s, nshards, per;
+	pthread_t *threads;
+	uint64_t rc = 0;
+
+	if (!lsb || !count || !dst || !src || !nthreads)
+		return 0;
+
+	if (nthreads == 1) {
+		scan_inherit_or0(dst, src);
+		return search_advance_bytype(lsb, count, dst,
+		                             src->mode & SIMD_PRIMETYPE_MASK);
+	}
+
+	nshards = nthreads * SIMD_MT_SHARDS_PER_THREAD;
+	if (nshards > count)
+		nshards = count;
+
+	per = count / nshards;          // last shard also takes remainder
+
+	if (!stride)
+		stride = per * 128;     // see SKIPPED.RATIO; wasteful default
+
+	pool.shards = (struct SIMD_MTShard *)
+	              calloc(nshards, sizeof(struct SIMD_MTShard));
+	threads     = (pthread_t *) calloc(nthreads, sizeof(pthread_t));
+
+	if (!pool.shards || !threads) {
+		free(pool.shards);
+		free(threads);
+		return 0;
+	}
+
+	pool.nshards   = nshards;
+	pool.primetype = src->mode & SIMD_PRIMETYPE_MASK;
+
+#if !defined(NO_SIMD_NUMA)
+	pool.pin = pin;
+#else
+	(void) pin;
+#endif
+
+	for (s=0; s<nshards; ++s) {
+		struct SIMD_MTShard *shard = &( pool.shards[s] );
+
+		shard->ps    = *src;
+		shard->lsb   = &( lsb[ s * per ] );
+		shard->count = (s+1 < nshards) ? per : (count - s*per);
+
+		simd_mt_warmup(&( shard->ps ), s * stride);
+	}
+
+	for (s=0; s<nthreads; ++s) {
+		if (pthread_create(&( threads[s] ), NULL, simd_mt_worker,
+		                   &pool))
+			break;          // join only what actually started
+	}
+	nthreads = (unsigned int) s;
+
+			// degraded mode: no worker thread came up; the
+			// shard queue is pull-based, so draining it on
+			// the calling thread still completes the scan
+			// (without repinning the caller)
+	if (!nthreads) {
+#if !defined(NO_SIMD_NUMA)
+		pool.pin = 0;
+#endif
+		(void) simd_mt_worker(&pool);
+	}
+
+	for (s=0; s<nthreads; ++s)
+		pthread_join(threads[s], NULL);
+
+	rc   = pool.shards[ nshards-1 ].last;
+	*dst = pool.shards[ nshards-1 ].ps;
+
+	for (s=0; s<nshards; ++s)
+		wipe(&( pool.shards[s].ps ), sizeof(struct PP_Mod16bit));
+
+	free(pool.shards);
+	free(threads);
+
+	return rc;
+}
+#endif   //=====  /delimiter: parallel search engine  ========================
+
+
+#if !defined(NO_SIMD_PIPELINE)  //=====  delimiter: double-buffered pipeline  =
+// overlaps trial division with downstream consumption (Miller-Rabin,
+// async exponentiation engines): a producer thread runs the batched
+// driver loop into one of two survivor buffers while the caller's sink
+// consumes the other, so prescreening and primality testing run
+// concurrently instead of alternating
+//
+// POSIX threads only; define NO_SIMD_PIPELINE on platforms without them
+
+#include <pthread.h>
+
+// survivors per pipeline buffer; one buffer is in flight either way,
+// so this only trades handoff frequency against footprint
+//
+#define  SIMD_PIPE_BATCH  ((unsigned long) 4096)
+
+/*--------------------------------------
+ * shared pipeline state: two survivor buffers, flipping between
+ * producer (trial-division thread) and consumer (caller's sink)
+ */
+struct SIMD_Pipe {
+	uint64_t buf[ 2 ][ SIMD_PIPE_BATCH ];
+	unsigned long fill[ 2 ];        // survivors in buf[i], when full
+	unsigned int  full[ 2 ];        // 1: producer filled, consumer owns
+
+	uint64_t total;                 // survivors to produce, >0
+	uint64_t last;                  // producer's last lsb64
+
+	struct PP_Mod16bit *dst;        // producer-owned while running
+	unsigned int primetype;         // see PrimeType_t
+
+	unsigned int stop;              // consumer aborted; drain and exit
+
+	pthread_mutex_t lock;
+	pthread_cond_t  cond;
+} ;
+
+
+/*--------------------------------------
+ * producer: fill buffers alternately until 'total' survivors are out
+ * or the consumer flags a stop
+ */
+static void *simd_pipe_producer(void *arg)
+{
+	struct SIMD_Pipe *p = (struct SIMD_Pipe *) arg;
+	unsigned int i = 0;
+	uint64_t done = 0;
+
+	while (done < p->total) {
+		unsigned long now = SIMD_PIPE_BATCH;
+
+		if ((p->total - done) < (uint64_t) now)
+			now = (unsigned long) (p->total - done);
+
+		pthread_mutex_lock(&( p->lock ));
+		while (p->full[i] && !p->stop)
+			pthread_cond_wait(&( p->cond ), &( p->lock ));
+		pthread_mutex_unlock(&( p->lock ));
+
+		if (p->stop)
+			break;
+
+		p->last = search_advance_bytype(p->buf[i], now, p->dst,
+		                                p->primetype);
+		done += now;
+
+		// step past the last-reported candidate before resuming,
+		// FIPS states by their increment (see sink_advance())
+		//
+		if (p->primetype == SIMD_PRIMETYPE_FIPS186) {
+#if !defined(NO_SIMD_FIPS186PRIME)
+			fips_state_incr(p->dst);
+#endif
+		} else if ((p->primetype != SIMD_PRIMETYPE_TWIN) &&
+		           (p->primetype != SIMD_PRIMETYPE_SAFE)) {
+#if !defined(NO_SIMD_PLAINPRIME)
+			simd_advance_all(p->dst,
+			                 (p->dst->mod6 == 1) ? 4 : 2);
+#endif
+		}
+
+		pthread_mutex_lock(&( p->lock ));
+		p->fill[i] = now;
+		p->full[i] = 1;
+		pthread_cond_broadcast(&( p->cond ));
+		pthread_mutex_unlock(&( p->lock ));
+
+		i ^= 1;
+	}
+
+	return NULL;
+}
+
+
+/*--------------------------------------
+ * double-buffered streaming search [main entry point]
+ *
+ * as sink_advance(), but trial division runs in its own thread and
+ * overlaps the sink: while 'sink' processes one buffer, the next one
+ * already fills.  'sink' runs on the calling thread; returning nonzero
+ * from it terminates the search after the current buffer
+ *
+ * 'total' must be >0; an unbounded variant makes no sense here, the
+ * caller's consumption bounds the pipeline
+ *
+ * 'dst' is left at the last scanned candidate, as with sink_advance()
+ *
+ * returns last lsb64 enumerated; 0 if inputs are unusable
+ */
+static SIMD_OPTIONAL_FN uint64_t pipeline_advance(SIMD_SinkFn sink, void *ctx,
+                       uint64_t total,
+             struct PP_Mod16bit *dst,
+       const struct PP_Mod16bit *src)
+{
+	struct SIMD_Pipe p;
+	uint64_t consumed = 0, rc = 0;
+	unsigned int i = 0;
+	pthread_t thr;
+
+	if (!sink || !total || !dst || !src)
+		return 0;
+
+	memset(&p, 0, sizeof(p));
+
+	scan_inherit_or0(dst, src);
+
+	p.total     = total;
+	p.dst       = dst;
+	p.primetype = dst->mode & SIMD_PRIMETYPE_MASK;
+
+	pthread_mutex_init(&( p.lock ), NULL);
+	pthread_cond_init (&( p.cond ), NULL);
+
+	if (pthread_create(&thr, NULL, simd_pipe_producer, &p)) {
+		pthread_mutex_destroy(&( p.lock ));
+		pthread_cond_destroy (&( p.cond ));
+		return 0;
+	}
+
+	while (consumed < total) {
+		int srv;
+
+		pthread_mutex_lock(&( p.lock ));
+		while (!p.full[i])
+			pthread_cond_wait(&( p.cond ), &( p.lock ));
+		pthread_mutex_unlock(&( p.lock ));
+
+		srv = sink(ctx, p.buf[i], p.fill[i]);
+		consumed += p.fill[i];
+
+		pthread_mutex_lock(&( p.lock ));
+		p.fill[i] = 0;
+		p.full[i] = 0;
+		if (srv)
+			p.stop = 1;
+		pthread_cond_broadcast(&( p.cond ));
+		pthread_mutex_unlock(&( p.lock ));
+
+		if (srv)
+			break;
+
+		i ^= 1;
+	}
+
+	pthread_join(thr, NULL);
+
+	rc = p.last;
+
+	pthread_mutex_destroy(&( p.lock ));
+	pthread_cond_destroy (&( p.cond ));
+
+	wipe(p.buf, sizeof(p.buf));
+
+	return rc;
+}
+#endif   //=====  /delimiter: double-buffered pipeline  ======================
+
+
+#if !defined(NO_SIMD_BINWRITER)  //=====  delimiter: async binary writer  ====
+// streams survivor batches to a file as binary records, with the
+// write() calls issued from their own thread: disk/network I/O
+// overlaps the next scan window instead of serializing behind it
+// (per-entry hex printing remains available as the debug option)
+//
+// format, all fields MSB-first u64 (matching the hashed-stream
+// serialization above):
+//     "SIMDPRM0"  ||  prime count  ||  prime type  ||  total
+// then length-prefixed records until EOF:
+//     count  ||  count x survivor lsb64
+//
+// POSIX threads only; define NO_SIMD_BINWRITER on platforms without them
+
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+// survivors per buffered record; one 32KB+ write() per record
+//
+#define  SIMD_BINW_BATCH  ((unsigned long) 4096)
+
+/*--------------------------------------
+ * writer state: two record buffers, flipping between the queueing
+ * sink (scan thread) and the write()-issuing thread
+ */
+struct SIMD_BinWriter {
+	int fd;
+
+	uint64_t buf[ 2 ][ SIMD_BINW_BATCH +1 ];    // [0] is length prefix
+	unsigned long fill[ 2 ];        // u64s in buf[i], incl. prefix
+	unsigned int  full[ 2 ];        // 1: sink filled, writer owns
+
+	uint64_t written;               // survivors handed to write()
+
+	unsigned int qi;                // sink-side buffer index
+	unsigned int done;              // no further batches; drain and exit
+	int err;                        // first write() errno, if any
+
+	pthread_t thr;
+	unsigned int started;
+
+	pthread_mutex_t lock;
+	pthread_cond_t  cond;
+} ;
+//
+#define  SIMD_BINWRITER_INIT0  { -1, { { 0, }, }, { 0, }, { 0, }, 0, 0, 0, \
+                                 0, (pthread_t) 0, 0,                     \
+                                 PTHREAD_MUTEX_INITIALIZER,               \
+                                 PTHREAD_COND_INITIALIZER, }
+
+
+/*--------------------------------------
+ * full-buffer write(), restarted over partial writes and EINTR
+ */
+static int binw_write_all(int fd, const void *p, size_t bytes)
+{
+	const unsigned char *b = (const unsigned char *) p;
+
+	while (bytes) {
+		ssize_t wr = write(fd, b, bytes);
+
+		if (wr < 0) {
+			if (errno == EINTR)
+				continue;
+			return -1;
+		}
+
+		b     += wr;
+		bytes -= (size_t) wr;
+	}
+
+	return 0;
+}
+
+
+/*--------------------------------------
+ * writer thread: drain full record buffers until close flags 'done'
+ */
+static void *simd_binw_writer(void *arg)
+{
+	struct SIMD_BinWriter *bw = (struct SIMD_BinWriter *) arg;
+	unsigned int i = 0;
+
+	for (;;) {
+		pthread_mutex_lock(&( bw->lock ));
+		while (!bw->full[i] && !bw->done)
+			pthread_cond_wait(&( bw->cond ), &( bw->lock ));
+		pthread_mutex_unlock(&( bw->lock ));
+
+		if (!bw->full[i])
+			break;                          // done, all drained
+
+		if (!bw->err &&
+		    binw_write_all(bw->fd, bw->buf[i],
+		                   bw->fill[i] * sizeof(uint64_t)) < 0)
+			bw->err = errno;
+
+		pthread_mutex_lock(&( bw->lock ));
+		bw->fill[i] = 0;
+		bw->full[i] = 0;
+		pthread_cond_broadcast(&( bw->cond ));
+		pthread_mutex_unlock(&( bw->lock ));
+
+		i ^= 1;
+	}
+
+	return NULL;
+}
+
+
+/*--------------------------------------
+ * create 'path' and write the stream header; 'total' as announced to
+ * downstream readers (the record stream itself is self-terminating)
+ *
+ * returns >0 if the writer thread is running; <0 otherwise
+ */
+static SIMD_OPTIONAL_FN
+int binw_open(struct SIMD_BinWriter *bw, const char *path,
+               const struct PP_Mod16bit *ps, uint64_t total)
+{
+	uint64_t head[ 4 ];
+	uint64_t primes;
+
+	if (!bw || !path || !ps)
+		return cu_reportrc("invalid binary-writer setup", -1);
+
+	switch (ps->mode & SIMD_SEARCHTABLE_MASK) {
+	case SIMD_SEARCHTABLE_S:
+		primes = 576;
+		break;
+	case SIMD_SEARCHTABLE_M:
+		primes = 1856;
+		break;
+	case SIMD_SEARCHTABLE_L:
+		primes = 3456;
+		break;
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+	case SIMD_SEARCHTABLE_C:
+		primes = SIMDPRIME_COUNT_CUSTOM;
+		break;
+#endif
+	default:
+		primes = 0;
+		break;
+	}
+
+	memset(bw, 0, sizeof(*bw));
+
+	bw->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (bw->fd < 0)
+		return cu_reportrc("can not create binary output", -1);
+
+	memcpy(head, "SIMDPRM0", 8);
+	MSBF8_WRITE(&( head[1] ), primes);
+	MSBF8_WRITE(&( head[2] ), (uint64_t) (ps->mode &
+	                                      SIMD_PRIMETYPE_MASK));
+	MSBF8_WRITE(&( head[3] ), total);
+
+	if (binw_write_all(bw->fd, head, sizeof(head)) < 0) {
+		close(bw->fd);
+		bw->fd = -1;
+		return cu_reportrc("binary-output header failed", -1);
+	}
+
+	pthread_mutex_init(&( bw->lock ), NULL);
+	pthread_cond_init (&( bw->cond ), NULL);
+
+	if (pthread_create(&( bw->thr ), NULL, simd_binw_writer, bw)) {
+		pthread_mutex_destroy(&( bw->lock ));
+		pthread_cond_destroy (&( bw->cond ));
+		close(bw->fd);
+		bw->fd = -1;
+		return cu_reportrc("binary-writer thread failed", -1);
+	}
+	bw->started = 1;
+
+	return 1;
+}
+
+
+/*--------------------------------------
+ * SIMD_SinkFn queueing batches to the writer thread; 'ctx' is the
+ * struct SIMD_BinWriter
+ *
+ * serializes to MSB-first in the free buffer, then hands it over;
+ * only blocks when both buffers are still being written
+ */
+static SIMD_OPTIONAL_FN
+int binw_sink(void *ctx, const uint64_t *lsb, unsigned long count)
+{
+	struct SIMD_BinWriter *bw = (struct SIMD_BinWriter *) ctx;
+	unsigned long i;
+
+	while (count) {
+		unsigned long now = SIMD_BINW_BATCH;
+		unsigned int qi = bw->qi;
+		uint64_t *b = bw->buf[ qi ];
+
+		if (count < now)
+			now = count;
+
+		pthread_mutex_lock(&( bw->lock ));
+		while (bw->full[ qi ])
+			pthread_cond_wait(&( bw->cond ), &( bw->lock ));
+		pthread_mutex_unlock(&( bw->lock ));
+
+		if (bw->err)
+			return 1;                     // stop the scan early
+
+		MSBF8_WRITE(&( b[0] ), (uint64_t) now);
+		for (i=0; i<now; ++i)
+			MSBF8_WRITE(&( b[ i+1 ] ), lsb[i]);
+
+		pthread_mutex_lock(&( bw->lock ));
+		bw->fill[ qi ] = now +1;
+		bw->full[ qi ] = 1;
+		pthread_cond_broadcast(&( bw->cond ));
+		pthread_mutex_unlock(&( bw->lock ));
+
+		bw->written += now;
+		bw->qi       = qi ^ 1;
+
+		lsb   += now;
+		count -= now;
+	}
+
+	return 0;
+}
+
+
+/*--------------------------------------
+ * drain, stop the writer thread and close the file
+ *
+ * returns >0 if everything reached the file; <0 after write errors
+ */
+static SIMD_OPTIONAL_FN int binw_close(struct SIMD_BinWriter *bw)
+{
+	int rc = 1;
+
+	if (!bw || (bw->fd < 0))
+		return 0;
+
+	if (bw->started) {
+		pthread_mutex_lock(&( bw->lock ));
+		bw->done = 1;
+		pthread_cond_broadcast(&( bw->cond ));
+		pthread_mutex_unlock(&( bw->lock ));
+
+		pthread_join(bw->thr, NULL);
+
+		pthread_mutex_destroy(&( bw->lock ));
+		pthread_cond_destroy (&( bw->cond ));
+	}
+
+	if (bw->err)
+		rc = cu_reportrc("binary-output write failed", -1);
+
+	close(bw->fd);
+	bw->fd = -1;
+
+	wipe(bw->buf, sizeof(bw->buf));
+
+	return rc;
+}
+#endif   //=====  /delimiter: async binary writer  ===========================
+#endif   //-----  !SIMD_BENCH  -----------------------------------------------
+
+
+#if 1  //=====  delimiter: standalone test code  =============================
+#define USE_OPENSSL   /* check conditionals below; add other CSPs if needed */
+
+/*--------------------------------------
+ * returns number of mode-specifying bits at start of 'base'
+ * sets ps->mode if recognized
+ *
+ * pass through any unrecognized setting, let subsequent checks detect them
+ */
+static size_t callmode(struct PP_Mod16bit *ps, const char *base)
+{
+	size_t skip = 0;
+
+	if (base) {
+		int scolon_2nd = (base[0] != '\0') && (base[1] == ':');
+		unsigned int mode = PP_MOD16_INVD_MODE;
+
+		switch (base[0]) {
+// TODO: constants
+		case 't':
+		case 'T':
+			mode = scolon_2nd
+			       ? SIMD_PRIMETYPE_TWIN
+			       : PP_MOD16_INVD_MODE;
+			skip = 2;
+			break;
+		case 's':
+		case 'S':
+			mode = scolon_2nd
+			       ? SIMD_PRIMETYPE_SAFE
+			       : PP_MOD16_INVD_MODE;
+			skip = 2;
+			break;
+#if !defined(NO_SIMD_FIPS186PRIME)
+		case 'f':
+		case 'F':
+			mode = scolon_2nd
+			       ? SIMD_PRIMETYPE_FIPS186
+			       : PP_MOD16_INVD_MODE;
+			skip = 2;
+			break;
+#endif
+
+// TODO: non-default prefix for plain-prime search?
+		default:
+			mode = SIMD_PRIMETYPE_PLAIN;
+			break;
+		}
+
+		if (ps)
+			ps->mode = mode;
+	}
+
+	return skip;
+}
+
+
+/*--------------------------------------
+ * calculate (nr) mod mods[] to res[]; (nr) imported from hex string
+ * other than avoiding division-by-zero, no sanity checking on modulus list
+ *
+ * opportunistically sets (nu64, u64s) to big-endian u64[] of (nr,nbytes),
+ * if result fits. otherwise, non-NULL array is set to all-0.
+ *
+ * processes chunks in 2^48 units, so all operations require carry-less
+ * u64 primitives only
+ *
+ * there is an upper limit on input size
+ * efficiency is irrelevant
+ */
+#if !defined(NO_SIMD_BATCHINIT)  //-----  batch state initialization  --------
+// reduces the full digit stream against 16 primes per group, without
+// per-prime division: Granlund-Montgomery/Lemire-style quotient
+// estimation from the precomputed floor(2^32/prime) magics
+// (see firstprimes_magic32_simd[])
+//
+// cuts the 3456 sequential modn16() bignum reductions of table init
+// to one stream pass per 16-prime group; relevant when states are
+// re-initialized at high rate (fresh random candidates)
+
+/*--------------------------------------
+ * fold one 16-bit chunk into 16 accumulator lanes:
+ *     acc = (acc * 2^16 + chunk) mod prime
+ *
+ * acc < prime < 2^15 keeps the dividend below 2^31, so the
+ * magic-multiply quotient estimate is off by at most one and a single
+ * conditional subtract restores [0, prime)
+ */
+static inline
+REALLY_FORCE_INLINE
+//
+void simd_modfold16x16(uint64_t acc[static 16], uint16_t chunk,
+               const uint16_t mods[static 16],
+              const uint32_t magic[static 16])
+{
+	unsigned int j;
+
+	for (j=0; j<16; ++j) {
+		uint64_t t = (acc[j] << 16) + chunk;
+		uint64_t q = (t * magic[j]) >> 32;
+		uint64_t r = t - q * mods[j];
+
+		acc[j] = (r >= mods[j]) ? r - mods[j] : r;
+	}
+}
+
+
+/*--------------------------------------
+ * batch equivalent of the per-prime modn16() loop in mod16bits():
+ * (n, nrd) is the big-endian u64[] digit form; chunks are folded
+ * MSB first
+ *
+ * processes full 16-prime groups only; caller covers any tail lanes
+ */
+static void simd_mod16bits_batch(uint16_t *res, const uint64_t *n,
+                          unsigned int nrd, size_t mcount)
+{
+	SIMD_ALIGN uint64_t acc[ 16 ];
+	size_t g;
+
+	for (g=0; g+16 <= mcount; g += 16) {
+		unsigned int i, j;
+
+		for (j=0; j<16; ++j)
+			acc[j] = 0;
+
+		for (i=0; i<nrd; ++i) {
+			uint64_t d = n[i];
+
+			simd_modfold16x16(acc, (uint16_t) (d >> 48),
+			                  &(firstprimes[g]),
+			                  &(firstprimes_magic32_simd[g]));
+			simd_modfold16x16(acc, (uint16_t) (d >> 32),
+			                  &(firstprimes[g]),
+			                  &(firstprimes_magic32_simd[g]));
+			simd_modfold16x16(acc, (uint16_t) (d >> 16),
+			                  &(firstprimes[g]),
+			                  &(firstprimes_magic32_simd[g]));
+			simd_modfold16x16(acc, (uint16_t)  d,
+			                  &(firstprimes[g]),
+			                  &(firstprimes_magic32_simd[g]));
+		}
+
+		for (j=0; j<16; ++j)
+			res[ g+j ] = (uint16_t) acc[j];
+	}
+
+	wipe(acc, sizeof(acc));
+}
+#endif   //-----  !NO_SIMD_BATCHINIT  ----------------------------------------
+
+
+/*--------------------------------------
+ * reduction core of mod16bits(): calculate (n, nrd) mod mods[] to
+ * res[], with (n, nrd) already in big-endian u64[] digit form
+ *
+ * other than avoiding division-by-zero, no sanity checking on modulus
+ * list
+ */
+static int mod16digits(uint16_t *res,
+           const uint64_t *n,    unsigned int nrd,
+           const uint16_t *mods,       size_t mcount)
+{
+	unsigned int m;
+
+	if (!res || !n || !nrd || (nrd > (PP_MAX_NR_BITS /64)) ||
+	    !mods || !mcount || (mcount > SIMDPRIME_COUNT))
+		return -1;
+
+#if !defined(NO_SIMD_BATCHINIT)
+	if (mods == firstprimes) {              // magics match this table only
+		simd_mod16bits_batch(res, n, nrd, mcount);
+
+		m = (unsigned int) (mcount - (mcount % 16));
+	} else {
+		m = 0;
+	}
+
+	for (/* tail, or full scalar fallback */; m<mcount; ++m) {
+#else
+	for (m=0; m<mcount; ++m) {
+#endif
+		if (!mods[m])
+			return -3;
+
+		res[m] = modn16(n, nrd, mods[m]);
+	}
+
+	return (int) nrd;
+}
+
+
+static int mod16bits(uint16_t *res,
+                     uint64_t *nu64, unsigned int u64s,
+          const unsigned char *nr,     size_t nbytes,
+               const uint16_t *mods,   size_t mcount)
+{
+	uint64_t n[ PP_MAX_NR_BITS / 64 ] = { 0, };
+	unsigned int m, nrd = 0;
+
+	if (!res || !nr || !nbytes || (nbytes > ((PP_MAX_NR_BITS +7) /8)) ||
+	    !mods || !mcount || (mcount > SIMDPRIME_COUNT))
+		return -1;
+
+	if (nu64 && u64s)
+		memset(nu64, 0, u64s*sizeof(uint64_t));
+
+	nrd = bin2u64(n, ARRAY_ELEMS(n), nr, nbytes);
+	if (nrd > ARRAY_ELEMS(n))
+		return -2;
+
+	if (nu64 && (nrd <= u64s)) {
+		for (m=0; m<nrd; ++m)
+			nu64[m] = n[m];
+	}
+
+	return mod16digits(res, n, nrd, mods, mcount);
+}
+
+
+//--------------------------------------
+// 'base' read into ps->modn[]
+// 'addl' read into ps->incr[] if non-NULL
+// sets ps->mode to indicate search type
+//
+static int mod16read(struct PP_Mod16bit *ps, const char *base,
+                                             const char *addl)
+{
+	unsigned char raw[ PP_MAX_NR_BITS /8 ] = { 0, };
+	size_t rd, hexb;
+
+	if (!ps || !base)
+		return -1;
+
+	*ps = (struct PP_Mod16bit) PP_MOD16BIT_INIT0;
+
+	rd = callmode(ps, base);
+	if (ps->mode == PP_MOD16_INVD_MODE)
+		return cu_reportrc("unsupported search/mode", -1);
+
+	base += rd + hexprefix_advance(base +rd);
+	hexb =  strlen(base);
+
+	if (hexb > sizeof(ps->qstr))
+		return cu_reportrc("hex/value out of range", -1);
+
+	rd = cu_hex2bin(raw, ARRAY_ELEMS(raw), base, hexb);
+	if (rd > ARRAY_ELEMS(raw))
+		return cu_reportrc("hex/value bitcount range", -1);
+
+	memcpy(ps->qstr, base, hexb);
+
+	{
+	uint64_t ndigits[ (PP_MAX_NR_BITS +63) /64 ];          // scratch u64[]
+	int nrd;
+
+	nrd = mod16bits(ps->modn, ndigits, ARRAY_ELEMS(ndigits), raw, rd,
+	                firstprimes, SIMDPRIME_COUNT);
+	if (nrd < 0)
+		return -1;
+
+#if !defined(NO_SIMD_NARROW8)
+	simd_narrow8_refresh(ps);
+#endif
+
+	ps->mod6 = modn16(ndigits, nrd, 6);
+	ps->lsb  = ndigits[ nrd -1 ];
+
+	if (addl) {
+		addl += hexprefix_advance(addl);
+
+		rd = cu_hex2bin(raw, ARRAY_ELEMS(raw), addl, 0);
+		if (rd > ARRAY_ELEMS(raw))
+			return -1;
+
+		nrd = mod16bits(ps->incr, ndigits, ARRAY_ELEMS(ndigits),
+		                raw, rd, firstprimes, SIMDPRIME_COUNT);
+		if (nrd < 1)
+			return -1;
+		ps->iused = SIMDPRIME_COUNT;
+// TODO: proper list of failure scenarios -> reportrc() markers
+
+		ps->mod6incr = modn16(ndigits, nrd, 6);
+
+		ps->lsbi =  ndigits[ nrd -1 ];
+		ps->mode |= SIMD_FIELDSET_INCR;
+	}
+	}
+
+	return 1;
+}
+
+
+#if !defined(NO_SIMD_BINARYINIT)  //-----  zero-copy binary init  -------------
+// callers holding candidates in binary form (OpenSSL BIGNUM / GMP
+// limbs, network buffers) previously had to serialize to hex and feed
+// mod16read(); these entry points accept the binary forms directly,
+// skipping the text round-trip on the per-keygen-attempt path
+//
+// only directly-scannable types are accepted; increments have no
+// binary entry point (yet), use mod16read() for those
+
+/*--------------------------------------
+ * shared tail of binary state init: *ps from big-endian u64 digits
+ *
+ * returns >0 if successful, <0 otherwise, as mod16read()
+ */
+static inline
+int mod16set_digits(struct PP_Mod16bit *ps, const uint64_t *n,
+                      unsigned int nrd, unsigned int primetype)
+{
+	if (!ps || !n || !nrd || (nrd > (PP_MAX_NR_BITS /64)))
+		return -1;
+
+	switch (primetype) {
+#if !defined(NO_SIMD_TWINPRIME)
+	case SIMD_PRIMETYPE_TWIN:
+#endif
+#if !defined(NO_SIMD_SAFEPRIME)
+	case SIMD_PRIMETYPE_SAFE:            // [potential] fallthrough
+#endif
+#if !defined(NO_SIMD_PLAINPRIME)
+	case SIMD_PRIMETYPE_PLAIN:           // [potential] fallthrough
+#endif
+		break;
+
+	default:
+		return cu_reportrc("unsupported search/mode", -1);
+	}
+
+	*ps = (struct PP_Mod16bit) PP_MOD16BIT_INIT0;
+	ps->mode = primetype;
+
+	if (mod16digits(ps->modn, n, nrd, firstprimes, SIMDPRIME_COUNT) < 0)
+		return -1;
+
+#if !defined(NO_SIMD_NARROW8)
+	simd_narrow8_refresh(ps);
+#endif
+
+	ps->mod6 = modn16(n, nrd, 6);
+	ps->lsb  = n[ nrd -1 ];
+
+	return 1;
+}
+
+
+/*--------------------------------------
+ * init from little-endian u64 limbs (OpenSSL BIGNUM / GMP order);
+ * only digit order is normalized, nothing passes through text
+ *
+ * returns >0 if successful, <0 otherwise, as mod16read()
+ */
+static inline
+int mod16read_le64(struct PP_Mod16bit *ps, const uint64_t *limbs,
+                       unsigned int used,    unsigned int primetype)
+{
+	uint64_t n[ PP_MAX_NR_BITS /64 ];
+	unsigned int i;
+	int rc;
+
+	if (!ps || !limbs || !used || (used > ARRAY_ELEMS(n)))
+		return -1;
+
+	while ((used > 1) && !limbs[ used -1 ])      // skip high zero limbs
+		--used;
+
+	for (i=0; i<used; ++i)               // LE limb -> BE digit order
+		n[i] = limbs[ used -1 -i ];
+
+	rc = mod16set_digits(ps, n, used, primetype);
+
+	wipe(n, sizeof(n));
+
+	return rc;
+}
+
+
+/*--------------------------------------
+ * init from raw big-endian bytes, skipping the hex round-trip of
+ * mod16read()
+ *
+ * returns >0 if successful, <0 otherwise, as mod16read()
+ */
+static inline
+int mod16read_be(struct PP_Mod16bit *ps, const unsigned char *raw,
+                             size_t rbytes, unsigned int primetype)
+{
+	uint64_t n[ PP_MAX_NR_BITS /64 ] = { 0, };
+	unsigned int nrd;
+	int rc;
+
+	if (!ps || !raw || !rbytes || (rbytes > ((PP_MAX_NR_BITS +7) /8)))
+		return -1;
+
+	nrd = bin2u64(n, ARRAY_ELEMS(n), raw, rbytes);
+	if (nrd > ARRAY_ELEMS(n))
+		return -2;
+
+	rc = mod16set_digits(ps, n, nrd, primetype);
+
+	wipe(n, sizeof(n));
+
+	return rc;
+}
+#endif  //-----  !NO_SIMD_BINARYINIT  ----------------------------------------
+
+
+#if !defined(NO_SIMD_BATCHSCREEN) && \
+    !defined(NO_SIMD_BATCHINIT)   //-----  batch candidate prescreen  --------
+// screens externally generated, independent candidates (DH-parameter
+// validation backlogs etc.), where a full per-candidate state init
+// would dominate the trial division itself
+//
+// candidates are processed in blocks, prime-group-major: each group's
+// table rows are loaded once and folded against every still-live
+// candidate of the block -- the transpose of the scan kernels, which
+// amortize one candidate over many primes -- and rejected candidates
+// drop out of all deeper groups
+//
+// remainder rows come from the division-free folds of the batch state
+// init, hence the NO_SIMD_BATCHINIT dependency
+
+#define  SIMD_BATCHSCREEN_BLOCK  ((unsigned long) 16)
+
+/*--------------------------------------
+ * one candidate's 64-lane remainder row for the group based at lane
+ * 'g', folded from the big-endian u64[] digit form (n, nrd)
+ *
+ * acc[] is caller-maintained scratch, wipe with the other buffers
+ */
+static inline
+void batch_group_row(uint16_t row[static 64], uint64_t acc[static 16],
+            const uint64_t *n,  unsigned int nrd, unsigned int g)
+{
+	unsigned int s, i, j;
+
+	for (s=0; s<64; s+=16) {
+		for (j=0; j<16; ++j)
+			acc[j] = 0;
+
+		for (i=0; i<nrd; ++i) {
+			uint64_t d = n[i];
+
+			simd_modfold16x16(acc, (uint16_t) (d >> 48),
+			                  &(firstprimes[ g+s ]),
+			                  &(firstprimes_magic32_simd[ g+s ]));
+			simd_modfold16x16(acc, (uint16_t) (d >> 32),
+			                  &(firstprimes[ g+s ]),
+			                  &(firstprimes_magic32_simd[ g+s ]));
+			simd_modfold16x16(acc, (uint16_t) (d >> 16),
+			                  &(firstprimes[ g+s ]),
+			                  &(firstprimes_magic32_simd[ g+s ]));
+			simd_modfold16x16(acc, (uint16_t)  d,
+			                  &(firstprimes[ g+s ]),
+			                  &(firstprimes_magic32_simd[ g+s ]));
+		}
+
+		for (j=0; j<16; ++j)
+			row[ s+j ] = (uint16_t) acc[j];
+	}
+}
+
+
+/*--------------------------------------
+ * trial-divide 'count' independent candidates, each 'stride' LE u64
+ * limbs (OpenSSL BIGNUM / GMP order), against the first 'depth'
+ * tabulated primes; sets bit c of map[] for each candidate without a
+ * tabulated factor
+ *
+ * 'depth' is rounded down to a 64-multiple and clamped to the table,
+ * 0 selects full depth; map[] must hold (count +7)/8 bytes
+ *
+ * 2 and 3 are absent from the tables; even candidates and multiples
+ * of 3 are rejected by their mod-6 class instead
+ *
+ * returns the number of survivors, <0 on invalid inputs
+ */
+static SIMD_OPTIONAL_FN
+long batch_prescreen(uint8_t *map, const uint64_t *limbs,
+             unsigned int stride, unsigned long count,
+             unsigned int depth)
+{
+	uint64_t nd[ SIMD_BATCHSCREEN_BLOCK ][ PP_MAX_NR_BITS /64 ];
+	unsigned int nrd[ SIMD_BATCHSCREEN_BLOCK ];
+	SIMD_ALIGN uint16_t row[ 64 ];
+	SIMD_ALIGN uint16_t tmp[ 64 ];
+	SIMD_ALIGN uint16_t tm2[ 64 ];
+	SIMD_ALIGN uint64_t acc[ 16 ];
+	unsigned long c0, survivors = 0;
+
+	if (!map || !limbs || !stride || !count ||
+	    (stride > (PP_MAX_NR_BITS /64)))
+		return -1;
+
+	if (!depth || (depth > SIMDPRIME_COUNT))
+		depth = SIMDPRIME_COUNT;
+	depth -= depth % 64;
+	if (!depth)
+		depth = 64;
+
+	memset(map, 0, (size_t) ((count +7) /8));
+
+	for (c0=0; c0<count; c0 += SIMD_BATCHSCREEN_BLOCK) {
+		unsigned long now = count - c0;
+		unsigned int alive = 0, c, g, m6;
+
+		if (now > SIMD_BATCHSCREEN_BLOCK)
+			now = SIMD_BATCHSCREEN_BLOCK;
+
+				// LE limb -> BE digit order, per candidate
+		for (c=0; c<now; ++c) {
+			const uint64_t *src = &(limbs[ (c0 +c) * stride ]);
+			unsigned int used = stride, i;
+
+			while ((used > 1) && !src[ used -1 ])
+				--used;
+
+			for (i=0; i<used; ++i)
+				nd[c][i] = src[ used -1 -i ];
+			nrd[c] = used;
+
+			m6 = modn16(nd[c], used, 6);
+			if ((m6 % 2) && (m6 % 3))
+				alive |= 1u << c;
+		}
+
+		for (g=0; alive && (g < depth); g += 64) {
+			for (c=0; c<now; ++c) {
+				if (!(alive & (1u << c)))
+					continue;
+
+				batch_group_row(row, acc, nd[c], nrd[c], g);
+
+				if (!simd_nofactor64x16(tmp, tm2, row,
+				          &(firstprimes_inverse_simd[ g ]),
+				         &(firstprimes_mullimit_simd[ g ])))
+					alive &= ~(1u << c);
+			}
+		}
+
+		for (c=0; c<now; ++c) {
+			if (alive & (1u << c)) {
+				unsigned long b = c0 +c;
+
+				map[ b >> 3 ] |= (uint8_t) (1 << (b & 7));
+				++survivors;
+			}
+		}
+	}
+
+	wipe(nd,  sizeof(nd));
+	wipe(row, sizeof(row));
+	wipe(tmp, sizeof(tmp));
+	wipe(tm2, sizeof(tm2));
+	wipe(acc, sizeof(acc));
+
+	return (long) survivors;
+}
+#endif   //-----  !NO_SIMD_BATCHSCREEN  --------------------------------------
+
+
+//--------------------------------------
+static void set_default_table_size(struct PP_Mod16bit *ps)
+{
+	if (ps) {
+		ps->mode &= ~SIMD_SEARCHTABLE_MASK;
+
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+		ps->mode |= SIMD_SEARCHTABLE_C;
+#elif !defined(NO_SIMDDIVIDE_L)
+		ps->mode |= SIMD_SEARCHTABLE_L;
+#elif !defined(NO_SIMDDIVIDE_M)
+		ps->mode |= SIMD_SEARCHTABLE_M;
+#else
+		ps->mode |= SIMD_SEARCHTABLE_S;
+#endif
+	}
+}
+
+
+
+/*--------------------------------------
+ * opportunistic: possibly select nondefault prime count
+ * returns >0  if ps->mode has been modified
+ *         0   nothing to update
+ *         <0  unsupported inputs
+ *
+ * MAY update 'ps' even if parsing fails
+ */
+static SIMD_OPTIONAL_FN
+int override_table_size(struct PP_Mod16bit *ps, const char *primes)
+{
+	if (ps && primes) {
+		uint64_t v = 0;
+
+		ps->mode &= ~SIMD_SEARCHTABLE_MASK;
+
+		v = cu_readuint(primes, 0);
+
+		switch (v) {
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+			// generated builds advance exactly CUSTOM lanes;
+			// mixing in a stock chain depth would leave lanes
+			// stale, so only the generated size is accepted
+		case SIMDPRIME_COUNT_CUSTOM:
+			ps->mode |= SIMD_SEARCHTABLE_C;
+			break;
+#else
+
+#if !defined(NO_SIMDDIVIDE_L)
+		case 3456:
+			ps->mode |= SIMD_SEARCHTABLE_L;
+			break;
+#endif
+
+#if !defined(NO_SIMDDIVIDE_M)
+		case 1856:
+			ps->mode |= SIMD_SEARCHTABLE_M;
+			break;
+#endif
+
+#if !defined(NO_SIMDDIVIDE_S)
+		case 576:
+			ps->mode |= SIMD_SEARCHTABLE_S;
+			break;
+#endif
+#endif   // !SIMDPRIME_COUNT_CUSTOM
+
+		default:
+			return -1;
+		}
+
+		return 1;
+	}
+
+	return 0;
+}
+
+
+#if !defined(NO_SIMD_XL32) && \
+    !defined(SIMD_BENCH)          //-----  32-bit 'XL' prime tier  ------------
+// second-tier trial division with primes above the 16-bit tables, for
+// searches where the downstream per-survivor cost (4096-bit safe-prime
+// modexps) dwarfs even megaprime-range vector sieving
+//
+// u32 remainders over [65537, limit); tables are runtime-sieved and
+// heap-backed, unlike the compiled-in 16-bit tier.  engaged only as a
+// post-filter over candidates which already survived the 16-bit
+// chains, so the per-candidate cost is paid 1:SKIPPED.RATIO times
+//
+// remainders advance survivor-to-survivor; divisibility is an
+// OR-reduced zero-lane scan in the same autovectorizable form as the
+// 16-bit kernels, just without their unrolled fixed-count groups
+
+#define  SIMD_XL_MIN_PRIME  ((uint32_t) 65537)
+#define  SIMD_XL_MAX_LIMIT  ((uint32_t) 1 << 24)
+#define  SIMD_XL_DEF_LIMIT  ((uint32_t) 1 << 20)
+
+#define  SIMD_XL_BLOCK      ((unsigned long) 4096)  /* early-exit granularity */
+
+struct PP_Mod32bitXL {
+	uint32_t *primes;             // ascending, all in [65537, limit)
+	uint32_t *modn;               // value mod primes[], tracks lsb
+
+	unsigned long count;
+
+	uint64_t lsb;                 // low64( value modn[] refers to )
+} ;
+//
+#define  PP_MOD32BITXL_INIT0  { NULL, NULL, 0, 0, }
+
+
+//--------------------------------------
+static void xl_table_free(struct PP_Mod32bitXL *xl)
+{
+	if (xl) {
+		if (xl->modn)                    // remainders are value-derived
+			wipe(xl->modn, xl->count * sizeof(uint32_t));
+
+		free(xl->modn);
+		free(xl->primes);
+
+		*xl = (struct PP_Mod32bitXL) PP_MOD32BITXL_INIT0;
+	}
+}
+
+
+/*--------------------------------------
+ * sieve odd numbers up to 'limit', collect primes in [65537, limit)
+ *
+ * limit is clamped to (SIMD_XL_MIN_PRIME, SIMD_XL_MAX_LIMIT]; anything
+ * at or below the 16-bit tables selects the default
+ *
+ * returns >0  if successful
+ *         <0  if anything failed (allocation)
+ */
+static SIMD_OPTIONAL_FN
+int xl_table_build(struct PP_Mod32bitXL *xl, uint32_t limit)
+{
+	unsigned char *comp;              // 1 bit per odd number, 1: composite
+	unsigned long i, wr;
+	uint32_t p, m;
+
+	if (!xl)
+		return -1;
+
+	*xl = (struct PP_Mod32bitXL) PP_MOD32BITXL_INIT0;
+
+	if (limit <= SIMD_XL_MIN_PRIME)
+		limit = SIMD_XL_DEF_LIMIT;
+	if (limit > SIMD_XL_MAX_LIMIT)
+		limit = SIMD_XL_MAX_LIMIT;
+
+	comp = (unsigned char *) calloc(1, limit /16 +1);
+	if (!comp)
+		return -1;
+
+	for (p=3; ((uint64_t) p)*p < limit; p+=2) {
+		if (comp[ p >> 4 ] & (1 << ((p >> 1) & 7)))
+			continue;
+
+		for (m=p*p; m<limit; m+=2*p)
+			comp[ m >> 4 ] |= (unsigned char) (1 << ((m >> 1) & 7));
+	}
+
+	for (p=SIMD_XL_MIN_PRIME, wr=0; p<limit; p+=2) {
+		if (!(comp[ p >> 4 ] & (1 << ((p >> 1) & 7))))
+			++wr;
+	}
+
+	xl->primes = (uint32_t *) calloc(wr, sizeof(uint32_t));
+	xl->modn   = (uint32_t *) calloc(wr, sizeof(uint32_t));
+	if (!(xl->primes) || !(xl->modn)) {
+		free(comp);
+		xl_table_free(xl);
+		return -1;
+	}
+	xl->count = wr;
+
+	for (p=SIMD_XL_MIN_PRIME, i=0; p<limit; p+=2) {
+		if (!(comp[ p >> 4 ] & (1 << ((p >> 1) & 7))))
+			xl->primes[ i++ ] = p;
+	}
+
+	free(comp);
+
+	return 1;
+}
+
+
+/*--------------------------------------
+ * remainders of ps' current value over the sieved XL primes, derived
+ * by re-reading the stored hex form (mod32 residues are not tracked by
+ * the 16-bit engines, so the bignumber is reduced once, here)
+ *
+ * incremented (FIPS 186) searches step by a full bignumber, which the
+ * lsb64-delta advance below can not follow; they are rejected
+ *
+ * returns >0  if successful, <0 otherwise, as mod16read()
+ */
+static SIMD_OPTIONAL_FN int xl_mod32read(struct PP_Mod32bitXL *xl,
+            const struct PP_Mod16bit *ps)
+{
+	uint64_t n[ PP_MAX_NR_BITS /64 ] = { 0, };
+	unsigned long i;
+	size_t nrd;
+
+	if (!xl || !(xl->count) || !ps)
+		return -1;
+
+	if (SIMD_FIELDSET_INCR & ps->mode)
+		return cu_reportrc("XL tier: no incremented searches", -1);
+
+	nrd = hex2u64(n, ARRAY_ELEMS(n), ps->qstr, 0);
+	if (!nrd || (nrd > ARRAY_ELEMS(n)))
+		return -1;
+
+	for (i=0; i<xl->count; ++i)
+		xl->modn[i] = modn32(n, (unsigned int) nrd, xl->primes[i]);
+
+	xl->lsb = n[ nrd -1 ];
+
+	wipe(n, sizeof(n));
+
+	return 1;
+}
+
+
+/*--------------------------------------
+ * modn[] += adv with conditional subtract; adv MUST be under
+ * SIMD_XL_MIN_PRIME, so a single subtract renormalizes any lane
+ */
+static inline
+void xl_advance32(uint32_t *modn, const uint32_t *primes,
+             unsigned long count, uint32_t adv)
+{
+	unsigned long i;
+
+	for (i=0; i<count; ++i) {
+		uint32_t m = modn[i] + adv;
+
+		modn[i] = (m >= primes[i]) ? (m - primes[i]) : m;
+	}
+}
+
+
+//--------------------------------------
+// arbitrary-delta advance, chunked to conditional-subtract range
+//
+static void xl_advance(struct PP_Mod32bitXL *xl, uint64_t adv)
+{
+	while (adv) {
+		uint32_t step = (adv < SIMD_XL_MIN_PRIME)
+		                ? ((uint32_t) adv)
+		                : (SIMD_XL_MIN_PRIME -1);
+
+		xl_advance32(xl->modn, xl->primes, xl->count, step);
+
+		xl->lsb += step;
+		adv     -= step;
+	}
+}
+
+
+/*--------------------------------------
+ * >0 if no XL prime divides the current value; OR-reduced zero-lane
+ * scan, SIMD_XL_BLOCK lanes per early-exit check
+ */
+static int xl_has_no_factor(const struct PP_Mod32bitXL *xl)
+{
+	unsigned long g, i, lim;
+
+	for (g=0; g<xl->count; g+=SIMD_XL_BLOCK) {
+		uint32_t zero = 0;
+
+		lim = ((g +SIMD_XL_BLOCK) < xl->count)
+		      ? (g +SIMD_XL_BLOCK) : xl->count;
+
+		for (i=g; i<lim; ++i)
+			zero |= (xl->modn[i] == 0);
+
+		if (zero)
+			return 0;
+	}
+
+	return 1;
+}
+
+
+/*--------------------------------------
+ * twin form: neither u nor u+2 may pick up an XL factor
+ *
+ * (modn +2) stays under 2*p, so one conditional subtract renormalizes,
+ * as with the advance kernel
+ */
+static int xl_has_no_twinfactor(const struct PP_Mod32bitXL *xl)
+{
+	unsigned long g, i, lim;
+
+	for (g=0; g<xl->count; g+=SIMD_XL_BLOCK) {
+		uint32_t zero = 0;
+
+		lim = ((g +SIMD_XL_BLOCK) < xl->count)
+		      ? (g +SIMD_XL_BLOCK) : xl->count;
+
+		for (i=g; i<lim; ++i) {
+			uint32_t u2 = xl->modn[i] +2;
+
+			u2 = (u2 >= xl->primes[i]) ? (u2 - xl->primes[i]) : u2;
+
+			zero |= (xl->modn[i] == 0) | (u2 == 0);
+		}
+
+		if (zero)
+			return 0;
+	}
+
+	return 1;
+}
+
+
+/*--------------------------------------
+ * safe-prime form: neither Q nor 2Q+1 may pick up an XL factor
+ *
+ * 2*modn+1 is under 2*p (primes exceed 2^16, products fit u32), so the
+ * same single conditional subtract applies
+ */
+static int xl_has_no_spfactor(const struct PP_Mod32bitXL *xl)
+{
+	unsigned long g, i, lim;
+
+	for (g=0; g<xl->count; g+=SIMD_XL_BLOCK) {
+		uint32_t zero = 0;
+
+		lim = ((g +SIMD_XL_BLOCK) < xl->count)
+		      ? (g +SIMD_XL_BLOCK) : xl->count;
+
+		for (i=g; i<lim; ++i) {
+			uint32_t q2 = 2 * xl->modn[i] +1;
+
+			q2 = (q2 >= xl->primes[i]) ? (q2 - xl->primes[i]) : q2;
+
+			zero |= (xl->modn[i] == 0) | (q2 == 0);
+		}
+
+		if (zero)
+			return 0;
+	}
+
+	return 1;
+}
+
+
+/*--------------------------------------
+ * drop 16-bit-tier survivors picking up an XL factor; (lsb, count) is
+ * compacted in place, survivors keep their order
+ *
+ * entries MUST ascend from xl's current position, as driver outputs do;
+ * 'primetype' selects which form each entry is checked in
+ *
+ * returns nr. of surviving entries
+ */
+static
+SIMD_ISA_CLONES
+SIMD_OPTIONAL_FN
+unsigned long xl_filter_survivors(uint64_t *lsb, unsigned long count,
+                      struct PP_Mod32bitXL *xl, unsigned int primetype)
+{
+	unsigned long rd, wr = 0;
+	int pass;
+
+	if (!lsb || !xl || !(xl->count))
+		return 0;
+
+	for (rd=0; rd<count; ++rd) {
+		xl_advance(xl, lsb[rd] - xl->lsb);
+
+		switch (primetype & SIMD_PRIMETYPE_MASK) {
+#if !defined(NO_SIMD_TWINPRIME)
+		case SIMD_PRIMETYPE_TWIN:
+			pass = xl_has_no_twinfactor(xl);
+			break;
+#endif
+
+#if !defined(NO_SIMD_SAFEPRIME)
+		case SIMD_PRIMETYPE_SAFE:
+			pass = xl_has_no_spfactor(xl);
+			break;
+#endif
+
+		default:
+			pass = xl_has_no_factor(xl);
+			break;
+		}
+
+		if (pass)
+			lsb[ wr++ ] = lsb[rd];
+	}
+
+	return wr;
+}
+#endif  //-----  !NO_SIMD_XL32  -----------------------------------------------
+
+
+#if !defined(NO_SIMD_CHECKPOINT) && \
+    !defined(SIMD_BENCH)          //-----  checkpoint/resume  -----------------
+// persists a full search state, so long-running scans resume after
+// preemption instead of re-deriving tables through mod16bits()
+//
+// format: one 64-byte header, then the raw struct PP_Mod16bit of this
+// build.  the header pads to a full alignment unit, so a page-aligned
+// mmap() of the file presents the struct at its native 64-byte
+// alignment, and resuming costs a page-in, not a re-derivation
+//
+// files are written to '<path>.tmp' and then rename()d, so a crash
+// mid-write never clobbers the previous good checkpoint
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define SIMD_CKPT_MAGIC  UINT64_C(0x53494d44434b5031)        // "SIMDCKP1"
+
+struct SIMD_CkptHead {
+	uint64_t magic;
+	uint32_t size;               // sizeof(struct PP_Mod16bit), this build
+	uint32_t primes;             // SIMDPRIME_COUNT baked into this build
+	uint32_t narrow8;            // 8-bit lane count, 0 if compiled out
+
+	uint8_t  pad[ 64 -8 -3*4 ];  // reserve one full alignment unit
+} ;
+
+
+/*--------------------------------------
+ * fills *h as expected by the current build
+ */
+static void simd_ckpt_head(struct SIMD_CkptHead *h)
+{
+	memset(h, 0, sizeof(*h));
+
+	h->magic  = SIMD_CKPT_MAGIC;
+	h->size   = (uint32_t) sizeof(struct PP_Mod16bit);
+
+			// effective depth: generated builds advance fewer
+			// lanes than the backing tables hold
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+	h->primes = SIMDPRIME_COUNT_CUSTOM;
+#else
+	h->primes = SIMDPRIME_COUNT;
+#endif
+
+#if !defined(NO_SIMD_NARROW8)
+	h->narrow8 = SIMDPRIME_8BIT_COUNT;
+#endif
+}
+
+
+/*--------------------------------------
+ * atomically persist *ps to 'path': write '<path>.tmp', then rename()
+ *
+ * returns >0  written
+ *         <0  error
+ */
+static SIMD_OPTIONAL_FN
+int simd_state_save(const char *path, const struct PP_Mod16bit *ps)
+{
+	struct SIMD_CkptHead h;
+	char tmp[ 256 ];
+	int fd, rc = -1;
+
+	if (!path || !ps)
+		return -1;
+
+	if ((size_t) snprintf(tmp, sizeof(tmp), "%s.tmp", path) >=
+	    sizeof(tmp))
+		return cu_reportrc("checkpoint path too long", -1);
+
+	simd_ckpt_head(&h);
+
+	fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return cu_reportrc("checkpoint create failed", -1);
+
+	if ((write(fd, &h, sizeof(h))   == (ssize_t) sizeof(h))   &&
+	    (write(fd, ps, sizeof(*ps)) == (ssize_t) sizeof(*ps)) &&
+	    (fsync(fd) == 0))
+		rc = 1;
+
+	if (close(fd) < 0)
+		rc = -1;
+
+	if ((rc > 0) && (rename(tmp, path) < 0))
+		rc = -1;
+
+	if (rc < 0)
+		return cu_reportrc("checkpoint write failed", -1);
+
+	return rc;
+}
+
+
+/*--------------------------------------
+ * restore *ps from a checkpoint written by simd_state_save()
  *
- * MAY update 'ps' even if parsing fails
+ * maps the file read-only and copies the state out; the struct sits at
+ * native alignment behind the one-unit header, see struct SIMD_CkptHead
+ *
+ * returns >0  restored
+ *         0   no checkpoint at 'path'
+ *         <0  file exists but does not match this build
  */
-static int override_table_size(struct PP_Mod16bit *ps, const char *primes)
+static SIMD_OPTIONAL_FN
+int simd_state_restore(const char *path, struct PP_Mod16bit *ps)
 {
-	if (ps && primes) {
-		uint64_t v = 0;
+	struct SIMD_CkptHead exp;
+	const uint8_t *map;
+	struct stat st;
+	int fd, rc = -1;
 
-		ps->mode &= ~SIMD_SEARCHTABLE_MASK;
-
-		v = cu_readuint(primes, 0);
+	if (!path || !ps)
+		return -1;
 
-		switch (v) {
-#if !defined(NO_SIMDDIVIDE_L)
-		case 3456:
-			ps->mode |= SIMD_SEARCHTABLE_L;
-			break;
-#endif
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return 0;                           // nothing to resume from
 
-#if !defined(NO_SIMDDIVIDE_M)
-		case 1856:
-			ps->mode |= SIMD_SEARCHTABLE_M;
-			break;
-#endif
+	simd_ckpt_head(&exp);
 
-#if !defined(NO_SIMDDIVIDE_S)
-		case 576:
-			ps->mode |= SIMD_SEARCHTABLE_S;
-			break;
-#endif
+	if ((fstat(fd, &st) < 0) ||
+	    (st.st_size != (off_t) (sizeof(exp) + sizeof(*ps)))) {
+		close(fd);
+		return cu_reportrc("checkpoint size mismatch", -1);
+	}
 
-		default:
-			return -1;
+	map = (const uint8_t *) mmap(NULL, sizeof(exp) + sizeof(*ps),
+	                             PROT_READ, MAP_PRIVATE, fd, 0);
+	if (map != MAP_FAILED) {
+		if (!memcmp(map, &exp, sizeof(exp))) {
+			memcpy(ps, map + sizeof(exp), sizeof(*ps));
+			rc = 1;
 		}
 
-		return 1;
+		munmap((void *) (uintptr_t) map, sizeof(exp) + sizeof(*ps));
 	}
+	close(fd);
 
-	return 0;
+	if (rc < 0)
+		return cu_reportrc("checkpoint does not match build", -1);
+
+	return rc;
 }
+#endif  //-----  !NO_SIMD_CHECKPOINT  ----------------------------------------
+
 
+#if !defined(SIMDDIVIDE_EMBED)   // nothing below survives embedding:
+                                 // simddivide.h exposes the entry points
 
+#if !defined(SIMD_BENCH)
 //--------------------------------------
 static int searchtype_uses_increment(const struct PP_Mod16bit *ps)
 {
 	return (ps && (SIMD_PRIMETYPE_FIPS186 & ps->mode));
 }
+#endif
 
 
 //--------------------------------------
@@ -3500,6 +8650,11 @@ static unsigned int report_table_prime_count(const struct PP_Mod16bit *ps)
 		case SIMD_SEARCHTABLE_S:
 			return 576;
 
+#if defined(SIMDPRIME_COUNT_CUSTOM)
+		case SIMD_SEARCHTABLE_C:
+			return SIMDPRIME_COUNT_CUSTOM;
+#endif
+
 		default:
 			return 0;
 	}
@@ -3528,12 +8683,25 @@ static const char *report_prime_type(const struct PP_Mod16bit *ps)
 }
 
 
+#if !defined(SIMD_BENCH)  /*-----  array-filling test driver  --------------*/
+
 //--------------------------------------
 // allow measuring millions of iterations, w/o blowing up stack
 //
 #define  SF_TEST_UNITS  ((unsigned long) 10000000)
 //
+#if !defined(NO_SIMD_NUMA)
+static uint64_t *possible;     // simd_alloc_pages() early in main():
+                               // hugepage-backed, placed by first touch
+#else
 static uint64_t possible[ SF_TEST_UNITS ];
+#endif
+
+#if !defined(NO_SIMD_BITMAP)
+#define  SF_BITMAP_BITS  ((unsigned long) 65536)
+
+static uint8_t bitmap_out[ (SF_BITMAP_BITS +7) /8 ];
+#endif
 
 
 /* we hash together a concatenated be64[] version of all LSB 64 bits we
@@ -3579,12 +8747,150 @@ static void hash_buffer(uint64_t *p, unsigned int pn)
 		buffer2be64(p, pn);       // in-place BE64() || with no padding
 
 		EVP_Q_digest(NULL, "SHA512", NULL, p, pn*8, h, &hb);
-// TODO: output
+
+		{
+		size_t i;
+
+		printf("## SHA512.SURVIVORS=");
+		for (i=0; i<hb; ++i)
+			printf("%02x", h[i]);
+		printf("\n");
+		}
 	}
 }
 #endif    /*-----  USE_OPENSSL  --------------------------------------------*/
 
 
+/*--------------------------------------
+ * trivial SIMD_SinkFn: append batches to a caller-supplied array
+ *
+ * only exercises the streaming path; output is expected to match the
+ * slice-filling drivers bit for bit (see SINK below)
+ */
+struct SIMD_CollectSink {
+	uint64_t *out;
+
+	unsigned long used;
+} ;
+//
+static int simd_collect_sink(void *ctx, const uint64_t *lsb,
+                                   unsigned long count)
+{
+	struct SIMD_CollectSink *cs = (struct SIMD_CollectSink *) ctx;
+
+	memcpy(&( cs->out[ cs->used ] ), lsb, count * sizeof(uint64_t));
+	cs->used += count;
+
+	return 0;
+}
+
+
+#if !defined(NO_SIMD_BATCHSCREEN) && \
+    !defined(NO_SIMD_BATCHINIT)
+#define  SF_SCREEN_STRIDE  (PP_MAX_NR_BITS /64)
+
+/*--------------------------------------
+ * SCREEN=... mode: trial-divide a file of independent hex candidates,
+ * one per line ('#' comments and blank lines skipped), against the
+ * first 'depth' tabulated primes; reports the survivor bitmap
+ *
+ * returns 0 if successful, <0 otherwise
+ */
+static int screen_candidate_file(const char *path, unsigned int depth)
+{
+	char line[ (PP_MAX_NR_BITS /4) +16 ];
+	uint64_t nd[ PP_MAX_NR_BITS /64 ];
+	unsigned long count = 0, alloc = 0, i;
+	uint64_t *limbs = NULL;
+	uint8_t *map = NULL;
+	long rc = -1;
+	FILE *f;
+
+	f = fopen(path, "r");
+	if (!f)
+		return cu_reportrc("can not read candidate list", -1);
+
+	while (rc && fgets(line, sizeof(line), f)) {
+		const char *p = line;
+		unsigned int nrd;
+		uint64_t *dst;
+		size_t hexn;
+
+		while ((*p == ' ') || (*p == '\t'))
+			++p;
+		if (!*p || (*p == '\n') || (*p == '#'))
+			continue;
+
+		p    += hexprefix_advance(p);
+		hexn  = strspn(p, "0123456789abcdefABCDEF");
+
+		nrd = hexn ? (unsigned int) hex2u64(nd, ARRAY_ELEMS(nd),
+		                                    p, hexn)
+		           : 0;
+		if (!nrd || (nrd > ARRAY_ELEMS(nd))) {
+			cu_reportrc("invalid candidate line", -1);
+			rc = 0;                         // stop, clean up
+			break;
+		}
+
+		if (count == alloc) {
+			uint64_t *nl;
+
+			alloc = alloc ? (alloc * 2) : 256;
+			nl = (uint64_t *) realloc(limbs,
+			          alloc * SF_SCREEN_STRIDE * sizeof(uint64_t));
+			if (!nl) {
+				cu_reportrc("candidate-list alloc failed",
+				            -1);
+				rc = 0;
+				break;
+			}
+			limbs = nl;
+		}
+
+				// BE digit -> LE limb order, zero-padded
+		dst = &(limbs[ count * SF_SCREEN_STRIDE ]);
+		memset(dst, 0, SF_SCREEN_STRIDE * sizeof(uint64_t));
+
+		for (i=0; i<nrd; ++i)
+			dst[i] = nd[ nrd -1 -i ];
+		++count;
+	}
+	fclose(f);
+
+	if (rc && count)
+		map = (uint8_t *) calloc((count +7) /8, 1);
+
+	if (map) {
+		rc = batch_prescreen(map, limbs, SF_SCREEN_STRIDE, count,
+		                     depth);
+
+		printf("## SCREEN.CANDIDATES=%lu\n", count);
+		printf("## SCREEN.SURVIVORS=%ld\n", rc);
+
+		for (i=0; (rc > 0) && (i < count); ++i) {
+			if (map[ i >> 3 ] & (1 << (i & 7)))
+				printf("scr[%lu]=x%016" PRIx64 "\n", i,
+				       limbs[ i * SF_SCREEN_STRIDE ]);
+		}
+	} else {
+		if (rc && !count)
+			cu_reportrc("empty candidate list", -1);
+		rc = -1;
+	}
+
+	if (limbs) {
+		wipe(limbs, alloc * SF_SCREEN_STRIDE * sizeof(uint64_t));
+		free(limbs);
+	}
+	free(map);
+	wipe(nd, sizeof(nd));
+
+	return (rc < 0) ? -1 : 0;
+}
+#endif   // !NO_SIMD_BATCHSCREEN && !NO_SIMD_BATCHINIT
+
+
 //--------------------------------------
 int main(int argc, const char **argv)
 {
@@ -3592,9 +8898,26 @@ int main(int argc, const char **argv)
 	unsigned long i, pcount;
 	uint64_t rc;
 
+#if !defined(NO_SIMD_BITMAP)
+	struct SIMD_BitmapHead bmhead = SIMD_BITMAPHEAD_INIT0;
+#endif
+
 	--argc;
 	++argv;
 
+#if !defined(NO_SIMD_BATCHSCREEN) && \
+    !defined(NO_SIMD_BATCHINIT)
+	if (getenv("SCREEN")) {     // candidate-list mode: no start value
+		set_default_table_size(&ps);
+		if (override_table_size(&ps, getenv("PRIMES")) <0)
+			return cu_reportrc("invalid prime-count specified",
+			                   -1);
+
+		return screen_candidate_file(getenv("SCREEN"),
+		                       report_table_prime_count(&ps));
+	}
+#endif
+
 	if (argc < 1)
 		return cu_reportrc("missing starting value", -1);
 
@@ -3608,7 +8931,16 @@ int main(int argc, const char **argv)
 	if ((argc > 1) && searchtype_uses_increment(&ps))
 		printf("## INCR=%s\n", argv[1]);
 
-	pcount = SF_TEST_UNITS;
+	pcount = env2u64("COUNT", SF_TEST_UNITS);
+	if (!pcount || (pcount > SF_TEST_UNITS))
+		return cu_reportrc("invalid survivor count", -1);
+
+#if !defined(NO_SIMD_NUMA)
+	possible = (uint64_t *)
+	           simd_alloc_pages(SF_TEST_UNITS * sizeof(uint64_t));
+	if (!possible)
+		return cu_reportrc("survivor-buffer alloc failed", -1);
+#endif
 
 	set_default_table_size(&ps);
 	if (override_table_size(&ps, getenv("PRIMES")) <0)
@@ -3616,15 +8948,184 @@ int main(int argc, const char **argv)
 
 	printf("## PRIMES=%u\n", report_table_prime_count(&ps));
 	printf("## TYPE=%s\n",   report_prime_type(&ps));
+	printf("## COUNT=%lu\n", pcount);
+
+#if !defined(NO_SIMD_CHECKPOINT)
+	if (getenv("CKPT")) {               // resume, if a snapshot matches
+		int crc = simd_state_restore(getenv("CKPT"), &ps);
+
+		if (crc < 0)
+			return -1;
+		if (crc > 0)
+			printf("## CKPT.RESUME=x%016" PRIx64 "\n", ps.lsb);
+	}
+#endif
 
 	{
 	struct timespec start, end;
 
 	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &start);
 
-	if (getenv("TWIN") || (SIMD_PRIMETYPE_TWIN & ps.mode)) {
+#if defined(SIMD_STATS)
+	simd_stats_reset();
+#endif
+
+#if !defined(NO_SIMD_SCANBOUND)
+	if (getenv("BUDGET")) {        // bounded-result scan, this thread
+		if (getenv("SINK") || getenv("PIPE") || getenv("OUTFILE") ||
+		    (env2u64("THREADS", 1) > 1))
+			return cu_reportrc("BUDGET needs a direct driver",
+			                   -1);
+
+		simd_scan_limit(env2u64("BUDGET", 0));
+	}
+#endif
+
+#if !defined(NO_SIMD_MTSEARCH)
+	if (env2u64("THREADS", 1) > 1) {
+		rc = simd_mt_search(possible, pcount, &ps, &ps,
+		                    (unsigned int) env2u64("THREADS", 1),
+		                    env2u64("STRIDE", 0),
+		                    (unsigned int) env2u64("PIN", 0));
+
+	} else
+#endif
+#if !defined(NO_SIMD_BINWRITER)
+	if (getenv("OUTFILE")) {        // binary records, async write() thread
+		struct SIMD_BinWriter bw = SIMD_BINWRITER_INIT0;
+
+		if (binw_open(&bw, getenv("OUTFILE"), &ps, pcount) < 0)
+			return -1;
+
+#if !defined(NO_SIMD_PIPELINE)
+		if (getenv("PIPE"))
+			rc = pipeline_advance(binw_sink, &bw, pcount, &ps, &ps);
+		else
+#endif
+		rc = sink_advance(binw_sink, &bw, pcount, &ps, &ps);
+
+		printf("## OUT.SURVIVORS=%" PRIu64 "\n", bw.written);
+
+		if (binw_close(&bw) < 0)
+			return -1;
+
+		pcount = 0;     // streamed out, not collected; hex printing
+		                // and hashing below have nothing to report
+
+	} else
+#endif
+	if (getenv("SINK")) {
+		struct SIMD_CollectSink cs = { possible, 0, };
+
+		rc = sink_advance(simd_collect_sink, &cs, pcount, &ps, &ps);
+
+#if !defined(NO_SIMD_PIPELINE)
+	} else if (getenv("PIPE")) {            // threaded double-buffering
+		struct SIMD_CollectSink cs = { possible, 0, };
+
+		rc = pipeline_advance(simd_collect_sink, &cs, pcount,
+		                      &ps, &ps);
+#endif
+
+#if !defined(NO_SIMD_WHEEL210)
+	} else if (getenv("WHEEL")) {           // plain search, 210-wheel steps
+		rc = wheel_advance(possible, pcount, &ps, &ps);
+#endif
+
+#if !defined(NO_SIMD_WINDOWED)
+	} else if (getenv("WINDOW")) {          // plain search, windowed phases
+		rc = window_advance(possible, pcount, &ps, &ps);
+#endif
+
+#if !defined(NO_SIMD_BITMAP)
+	} else if (getenv("BITMAP")) {          // plain search, 1 bit/candidate
+		rc = bitmap_advance(bitmap_out, SF_BITMAP_BITS, &bmhead,
+		                    &ps, &ps);
+#endif
+
+#if !defined(NO_SIMD_SOA4)
+	} else if (getenv("SOA4")) {            // 4 interleaved plain streams
+		struct PP_Mod16bit strm[ SIMD_SOA_STREAMS ];
+		const struct PP_Mod16bit *srcs[ SIMD_SOA_STREAMS ];
+		struct SIMD_SoAOut out[ SIMD_SOA_STREAMS ];
+		static struct PP_Mod16bitX4 xs;
+		unsigned long per = pcount / SIMD_SOA_STREAMS;
+		unsigned int s;
+
+		for (s=0; s<SIMD_SOA_STREAMS; ++s) {
+			strm[s] = ps;
+			if (s)
+				state_jump(&(strm[s]),
+				           s * env2u64("STRIDE", 1000000));
+			srcs[s] = &(strm[s]);
+
+			out[s].lsb   = &(possible[ s * per ]);
+			out[s].count = per;
+			out[s].wr    = 0;
+		}
+
+		rc = (soa4_gather(&xs, srcs) > 0)
+		     ? soa4_plain_advance(out, &xs)
+		     : 0;
+		if (rc)
+			soa4_scatter(&ps, &xs, 0);
+#endif
+
+#if !defined(NO_SIMD_AUTOTUNE)
+	} else if (getenv("TUNE")) {    // depth from downstream cost, in ns
+		unsigned int lanes =
+		        simd_tune_depth(&ps, (double) env2u64("TUNE", 100000));
+
+		printf("## TUNEDEPTH=%u\n", lanes);
+
+		rc = tuned_advance(possible, pcount, &ps, &ps, lanes);
+#endif
+
+#if !defined(NO_SIMD_DUALSCAN)  && \
+    !defined(NO_SIMD_TWINPRIME) && \
+    !defined(NO_SIMD_SAFEPRIME)
+	} else if (getenv("DUAL")) {            // fused twin+safe, one pass
+		unsigned long per = pcount / 2;
+
+		rc = dual_advance(possible, &(possible[ per ]), per,
+		                  &ps, &ps);
+#endif
+
+#if !defined(NO_SIMD_KTUPLE)
+	} else if (getenv("TUPLE")) {   // constellation; comma-separated offsets
+		struct SIMD_KTuple kt = SIMD_KTUPLE_INIT0;
+		unsigned int offs[ SIMD_KTUPLE_MAX_OFFS ], on = 0;
+		const char *ts = getenv("TUPLE");
+
+		while (*ts && (on < ARRAY_ELEMS(offs))) {
+			char *tend = NULL;
+
+			offs[ on ] = (unsigned int) strtoul(ts, &tend, 0);
+			if (tend == ts)
+				break;
+			++on;
+
+			ts = tend + ((*tend == ',') ? 1 : 0);
+		}
+
+		if (ktuple_init(&kt, offs, on) <0)
+			return -1;
+
+		rc = ktuple_advance(possible, pcount, &ps, &ps, &kt);
+#endif
+
+	} else if (getenv("TWIN") || (SIMD_PRIMETYPE_TWIN & ps.mode)) {
 		rc = twin_advance_w(possible, pcount, &ps, &ps);
 
+#if !defined(NO_SIMD_FIPS186PRIME)
+	} else if (SIMD_PRIMETYPE_FIPS186 & ps.mode) {  // f:..., incremental
+		if (!(SIMD_FIELDSET_INCR & ps.mode))
+			return cu_reportrc("FIPS-186 search needs "
+			                   "an increment", -1);
+
+		rc = fips_advance(possible, pcount, &ps, &ps);
+#endif
+
 	} else if (getenv("PLAIN") || (SIMD_PRIMETYPE_PLAIN & ps.mode)) {
 		rc = plain_advance(possible, pcount, &ps, &ps);
 
@@ -3636,7 +9137,83 @@ int main(int argc, const char **argv)
 
 	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &end);
 	printf("DIFF=%.1fms\n", cu_msdelta2(&start, &end));
+
+#if defined(SIMD_STATS)
+	simd_stats_report();
+#endif
+
+#if !defined(NO_SIMD_SCANBOUND)
+	if (getenv("BUDGET")) {
+		uint64_t left = simd_scan_limit_clear();
+		unsigned long found = 0;
+
+		for (i=0; i<pcount; ++i)     // exhausted scans leave a tail
+			found += !!possible[i];  // of unwritten (zero) slots
+
+		printf("## BUDGET.LEFT=%"  PRIu64 "\n", left);
+		printf("## BUDGET.FOUND=%lu\n", found);
+
+		pcount = found;          // report only what has been found
+	}
+#endif
+	}
+
+#if !defined(NO_SIMD_CHECKPOINT)
+	if (getenv("CKPT")) {
+		if (simd_state_save(getenv("CKPT"), &ps) < 0)
+			return -1;
+
+		printf("## CKPT.SAVED=x%016" PRIx64 "\n", ps.lsb);
+	}
+#endif
+
+#if !defined(NO_SIMD_BITMAP)
+	if (getenv("BITMAP")) {
+		printf("## BITMAP.LSB=x%016" PRIx64 "\n", bmhead.lsb);
+		printf("## BITMAP.OFFSET=%"  PRIu64 "\n", bmhead.offset);
+		printf("## BITMAP.BITS=%"    PRIu64 "\n", bmhead.bits);
+		printf("## BITMAP.MOD6=%u\n", (unsigned int) bmhead.mod6);
+
+		for (i=0; i<512; ++i) {                 // leading slice only
+			printf("%02x", bitmap_out[i]);
+			if ((i % 32) == 31)
+				printf("\n");
+		}
+		printf("...\n");
+
+#if !defined(NO_SIMD_NUMA)
+		simd_free_pages(possible, SF_TEST_UNITS * sizeof(uint64_t));
+#endif
+
+		return 0;
+	}
+#endif
+
+#if !defined(NO_SIMD_XL32)
+	if (getenv("XL") && pcount) {           // second-tier filter, u32 primes
+		struct PP_Mod32bitXL xl = PP_MOD32BITXL_INIT0;
+		unsigned long xcount;
+
+		if (xl_table_build(&xl, (uint32_t)
+		                   env2u64("XL", SIMD_XL_DEF_LIMIT)) < 0)
+			return cu_reportrc("XL table alloc failed", -1);
+
+		if (xl_mod32read(&xl, &ps) < 0) {
+			xl_table_free(&xl);
+			return -1;
+		}
+
+		xcount = xl_filter_survivors(possible, pcount, &xl,
+		                             ps.mode & SIMD_PRIMETYPE_MASK);
+
+		printf("## XL.PRIMES=%lu\n",        xl.count);
+		printf("## XL.MAX=%u\n",            xl.primes[ xl.count -1 ]);
+		printf("## XL.SURVIVORS=%lu/%lu\n", xcount, pcount);
+
+		pcount = xcount;
+		xl_table_free(&xl);
 	}
+#endif
 
 	if (getenv("LOG_ALL") || (pcount < 100)) {
 		for (i=0; i<pcount; ++i)
@@ -3658,7 +9235,7 @@ int main(int argc, const char **argv)
 			// essentially irrelevant for the 10K+ lists
 			// we use as benchmarks
 			//
-	if (possible[0] < possible[ pcount-1 ]) {
+	if (pcount && (possible[0] < possible[ pcount-1 ])) {
 		rc = possible[ pcount-1 ] - possible[0];
 
 						// min(diff) == pcount*6
@@ -3671,9 +9248,178 @@ int main(int argc, const char **argv)
 
 	hash_buffer(possible, pcount);
 
+#if !defined(NO_SIMD_NUMA)
+	simd_free_pages(possible, SF_TEST_UNITS * sizeof(uint64_t));
+#endif
+
 	printf("\n");
 
 	return 0;
 }
+
+
+#else     /*-----  SIMD_BENCH: per-kernel microbenchmarks  -----------------*/
+
+/* times the individual hot kernels, not entire searches; build and run
+ * through 'make bench'
+ *
+ * each kernel runs BENCH.LOOP back-to-back calls per repeat, with the
+ * remainder table advanced between repeats so medians cover different
+ * candidates; warmup repeats are discarded
+ *
+ * reports median and minimum of per-repeat averages, per call and per
+ * 16-lane prime group, in rdtsc units (ns where rdtsc is unavailable)
+ *
+ * note: end-to-end DIFF=...ms from the array-filling driver averages
+ * over init+search; regressions of a single kernel hide in it
+ */
+
+#define  BENCH_WARMUP  ((unsigned int)  3)
+#define  BENCH_REPS    ((unsigned int) 33)           // excluding warmup
+#define  BENCH_LOOP    ((uint64_t)   4096)           // calls per repeat
+
+
+/*--------------------------------------
+ * raw tick counter; see BENCH.UNIT report for what it counts
+ */
+static inline uint64_t bench_ticks(void)
+{
+#if defined(__x86_64__) && defined(__GNUC__)
+	return __builtin_ia32_rdtsc();
+#else
+	struct timespec t;
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+
+	return ((uint64_t) t.tv_sec) * UINT64_C(1000000000) + t.tv_nsec;
+#endif
+}
+
+
+// consume a kernel result, preventing hoisting/CSE across bench
+// iterations; only the GNU-C form actually pins down the compiler
+//
+#if defined(__GNUC__)
+#define  BENCH_SINK(v)  \
+         __asm__ volatile("" :: "g" ((uint64_t) (v)) : "memory")
+#else
+static volatile uint64_t bench_sink_v;
+#define  BENCH_SINK(v)  (bench_sink_v += (uint64_t) (v))
+#endif
+
+
+//--------------------------------------
+static int bench_dblcmp(const void *a, const void *b)
+{
+	double av = *((const double *) a), bv = *((const double *) b);
+
+	return (av > bv) - (av < bv);
+}
+
+
+// time 'expr' (which sees ps/adv from the enclosing frame); 'groups'
+// is the number of 16-lane prime groups one call covers
+//
+#define BENCH_ONE(label, groups, expr)                                  \
+	do {                                                            \
+	double res[ BENCH_REPS ];                                       \
+	unsigned int r;                                                 \
+                                                                        \
+	for (r=0; r<BENCH_WARMUP+BENCH_REPS; ++r) {                     \
+		uint64_t t0, t1, n;                                     \
+                                                                        \
+		simd_advance_all(&ps, 6);                               \
+                                                                        \
+		t0 = bench_ticks();                                     \
+		for (n=0; n<loop; ++n)                                  \
+			BENCH_SINK(expr);                               \
+		t1 = bench_ticks();                                     \
+                                                                        \
+		if (r >= BENCH_WARMUP)                                  \
+			res[ r - BENCH_WARMUP ] =                       \
+				((double) (t1 - t0)) / ((double) loop); \
+	}                                                               \
+                                                                        \
+	qsort(res, BENCH_REPS, sizeof(res[0]), bench_dblcmp);           \
+                                                                        \
+	printf("%-30s med=%8.1f min=%8.1f /call  %7.2f /group [%u]\n",  \
+	       label, res[ BENCH_REPS /2 ], res[0],                     \
+	       res[ BENCH_REPS /2 ] / (groups),                         \
+	       (unsigned int) (groups));                                \
+	} while (0)
+
+
+//--------------------------------------
+int main(int argc, const char **argv)
+{
+	struct PP_Mod16bit ps = PP_MOD16BIT_INIT0;
+	struct SIMD_Advance adv = { 0, };
+	uint64_t loop = env2u64("LOOP", BENCH_LOOP);
+
+	const char *base = (argc > 1)
+	      ? argv[1]
+	      : "0xc90fdaa22168c234c4c6628b80dc1cd129024e088a67cc74"
+	        "020bbea63b139b22514a08798e3404dd";
+
+	if (mod16read(&ps, base, NULL) <0)
+		return -1;
+
+	set_default_table_size(&ps);
+	if (override_table_size(&ps, getenv("PRIMES")) <0)
+		return cu_reportrc("invalid prime-count specified", -1);
+
+#if defined(__x86_64__) && defined(__GNUC__)
+	printf("## BENCH.UNIT=rdtsc\n");
+#else
+	printf("## BENCH.UNIT=ns\n");
+#endif
+	printf("## BENCH.LOOP=%lu\n", (unsigned long) loop);
+	printf("## BENCH.REPS=%u+%u\n", BENCH_WARMUP, BENCH_REPS);
+	printf("## PRIMES=%u\n", report_table_prime_count(&ps));
+	printf("## TYPE=%s\n",   report_prime_type(&ps));
+
+	BENCH_ONE("simd_is_all0x64x16_inpl", 4,
+	          simd_is_all0x64x16_inpl(adv.tmp, adv.tm2));
+
+	BENCH_ONE("simd_nofactor_first", 4,
+	          simd_nofactor_first(adv.tmp, adv.tm2, &ps));
+
+	BENCH_ONE("simd_nofactor_rest_s", 32,
+	          simd_nofactor_rest_s(adv.tmp, adv.tm2, &ps));
+
+#if !defined(NO_SIMDDIVIDE_M) && defined(NO_SIMDDIVIDE_L)
+	BENCH_ONE("simd_nofactor_rest_m", 80,
+	          simd_nofactor_rest_m(adv.tmp, adv.tm2, &ps));
+#endif
+
+#if !defined(NO_SIMDDIVIDE_L)
+	BENCH_ONE("simd_nofactor_rest_l", 100,
+	          simd_nofactor_rest_l(adv.tmp, adv.tm2, &ps));
+#endif
+
+	BENCH_ONE("simd_advance_remainders_first", 4,
+	          (simd_advance_remainders_first(&ps, 6), 0));
+
+#if !defined(NO_SIMDDIVIDE_L)
+	BENCH_ONE("simd_advance_remainders_rest_l", 212,
+	          (simd_advance_remainders_rest_l(&ps, 6), 0));
+#endif
+
+#if !defined(NO_SIMD_TWINPRIME) && !defined(NO_SIMDDIVIDE_L)
+	BENCH_ONE("simd_no_twinfactor_rest_l", 212,
+	          simd_no_twinfactor_rest_l(adv.tmp, adv.tm2, ps.modn));
+#endif
+
+			// full-table jump: scalar per-prime folds, then
+			// one vectorized conditional reduction per group
+	BENCH_ONE("state_jump(1M)", SIMDPRIME_COUNT /16,
+	          state_jump(&ps, 1000000));
+
+	wipe_advance_struct(&adv);
+
+	return 0;
+}
+#endif    /*-----  SIMD_BENCH  ---------------------------------------------*/
+#endif   //-----  !SIMDDIVIDE_EMBED  ----------------------------------------
 #endif   //=====  /delimiter: standalone test code  ==========================
 